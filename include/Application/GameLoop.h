@@ -1,7 +1,9 @@
 #pragma once
 #include <SFML/Graphics.hpp>
+#include <memory>
 
 class WindowManager;
+class RenderThread;
 
 /**
  * @brief Handles the main game loop execution.
@@ -14,6 +16,9 @@ class WindowManager;
  * - Update game logic with accurate timing (deltaTime).
  * - Render current screen/frame.
  * - Handle runtime errors without crashing the application.
+ *
+ * Rendering runs on a RenderThread: each frame the current screen records a
+ * command list that is replayed while the next frame is being updated.
  */
 class GameLoop {
 public:
@@ -25,9 +30,9 @@ public:
     explicit GameLoop(WindowManager& windowManager);
 
     /**
-     * @brief Default destructor.
+     * @brief Stops the render thread if the loop is still running.
      */
-    ~GameLoop() = default;
+    ~GameLoop();
 
     /**
      * @brief Starts the main loop and keeps running until the window is closed.
@@ -52,7 +57,10 @@ private:
     void updateGame(float deltaTime);
 
     /**
-     * @brief Renders the current game state to the screen.
+     * @brief Records the current screen and hands it to the render thread.
+     *
+     * Screens that cannot record are drawn through a callback, and the loop
+     * waits for that frame so they never run concurrently with update().
      */
     void renderGame();
 
@@ -67,6 +75,7 @@ private:
     // === Members ===
     WindowManager& m_windowManager;  ///< Reference to the window manager.
     sf::Clock m_clock;               ///< Clock used for measuring frame time.
+    std::unique_ptr<RenderThread> m_renderThread;  ///< Replays recorded frames while running.
 
     // Frame rate limiter to avoid unstable delta time
     static constexpr float MAX_DELTA_TIME = 1.0f / 30.0f; ///< Maximum allowed delta time (30 FPS floor).
@@ -42,6 +42,11 @@ public:
      */
     void setFramerateLimit(unsigned int fps);
 
+    /**
+     * @brief Returns the frame limit last set with setFramerateLimit (0 = none).
+     */
+    unsigned int getFramerateLimit() const { return m_framerateLimit; }
+
     /**
      * @brief Enables or disables vertical synchronization.
      *
@@ -100,6 +105,7 @@ private:
     unsigned int m_width = 800;   ///< Window width in pixels (default: 800).
     unsigned int m_height = 600;  ///< Window height in pixels (default: 600).
     std::string m_title = "Default Window"; ///< Initial window title.
+    unsigned int m_framerateLimit = 0;      ///< Requested FPS limit (0 = unlimited).
 
     /**
      * @brief Validates window settings before creation.
@@ -2,6 +2,8 @@
 #include "Component.h"
 #include <SFML/Graphics.hpp>
 #include <memory>
+#include <cstdint>
+#include "RenderLayer.h"
 
 /**
  * @class RenderComponent
@@ -16,6 +18,9 @@ public:
 
     /**
      * @brief Sets the texture used by the internal sprite.
+     *
+     * If the texture was packed into the TextureAtlas, the sprite is pointed at
+     * the atlas page and its sub-rectangle instead; the visible result is the same.
      * @param texture Reference to a loaded SFML texture.
      */
     void setTexture(const sf::Texture& texture);
@@ -38,6 +43,26 @@ public:
      */
     const sf::Sprite& getSprite() const;
 
+    /**
+     * @brief Marks the sprite as never moving or changing after setup.
+     *
+     * Static sprites are baked into the StaticTileLayer instead of being
+     * submitted individually each frame.
+     */
+    void setStatic(bool isStatic) { m_static = isStatic; }
+    bool isStatic() const { return m_static; }
+
+    /**
+     * @brief Layer and in-layer depth used to build the RenderQueue sort key.
+     */
+    void setLayer(RenderLayer layer) { m_layer = layer; }
+    RenderLayer getLayer() const { return m_layer; }
+    void setDepth(std::uint16_t depth) { m_depth = depth; }
+    std::uint16_t getDepth() const { return m_depth; }
+
 private:
     sf::Sprite m_sprite; ///< Sprite used for rendering the entity.
+    bool m_static = false; ///< True if the sprite can be baked into the static tile layer.
+    RenderLayer m_layer = RenderLayer::World; ///< Draw layer.
+    std::uint16_t m_depth = 0; ///< Order inside the layer for sprites sharing a texture.
 };
@@ -1,6 +1,8 @@
 #pragma once
 #include <SFML/Graphics.hpp>
 
+class RenderCommandList;
+
 /**
  * @brief Interface for all game screens (menu, gameplay, settings, etc.)
  *
@@ -20,6 +22,11 @@ public:
     // Draw everything to screen (sprites, text, UI)
     virtual void render(sf::RenderWindow& window) = 0;
 
+    // Record the frame for the render thread instead of drawing it.
+    // Return false to be drawn with render() on the render thread while
+    // the game loop waits.
+    virtual bool record(RenderCommandList& /*commands*/, sf::RenderWindow& /*window*/) { return false; }
+
     // Optional lifecycle hooks
     virtual void onEnter() {}
     virtual void onExit() {}
@@ -10,4 +10,6 @@ namespace ResourcePaths {
     constexpr const char* LEVEL1 = "level1.txt";
     constexpr const char* LEVEL2 = "level2.txt";
     constexpr const char* DARK_LEVEL = "dark_level.txt";
+
+    constexpr const char* TEXTURE_ATLAS_CACHE = "texture_atlas.cache";
 }
@@ -31,6 +31,9 @@ public:
     // Render the current screen
     void render(sf::RenderWindow& window);
 
+    // Record the current screen for the render thread; false if it only renders directly
+    bool record(RenderCommandList& commands, sf::RenderWindow& window);
+
     // Get the current screen (optional, for debugging)
     IScreen* getCurrentScreen() const { return m_currentScreen.get(); }
 
@@ -2,6 +2,8 @@
 #include "EnemyEntity.h"
 #include <map>
 
+class RenderQueue;
+
 /**
  * SmartEnemyEntity - Intelligent enemy with advanced AI decision making
  * Features: Situational analysis, predictive behavior, strategy learning, coordination
@@ -12,7 +14,7 @@ public:
 
     void update(float dt) override;
     void updateEyeColors();
-    void drawEyes(sf::RenderWindow& window);
+    void appendEyes(RenderQueue& queue) const;
 
 
 protected:
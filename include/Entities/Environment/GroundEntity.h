@@ -11,13 +11,28 @@
  */
 class GroundEntity : public Entity {
 public:
+    /**
+     * Everything about a tile that depends only on its type: the prepared
+     * sprite (atlas region and origin), the body size and where the centre
+     * sits inside the tile. Built once per type, copied into every tile.
+     */
+    struct Prototype {
+        TileType type = TileType::Ground;
+        sf::Sprite sprite;
+        sf::Vector2f boxSize;
+        sf::Vector2f centerOffset;
+    };
+
+    static Prototype makePrototype(TileType type, TextureManager& textures);
+
     GroundEntity(IdType id, TileType type, b2World& world, float x, float y, TextureManager& textures);
+    GroundEntity(IdType id, const Prototype& prototype, b2World& world, float x, float y);
 
     TileType getTileType() const { return m_tileType; }
 
 private:
-    void setupComponents(TileType type, b2World& world, float x, float y, TextureManager& textures);
-    std::string getTextureNameForType(TileType type) const;
+    void setupComponents(const Prototype& prototype, b2World& world, float x, float y);
+    static std::string getTextureNameForType(TileType type);
 
     TileType m_tileType;
 };
\ No newline at end of file
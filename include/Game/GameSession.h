@@ -11,6 +11,7 @@
 #include "PlayerEntity.h"
 #include "ResourceManager.h"
 #include <DarkLevelSystem.h>
+#include "EventTapeRecorder.h"
 
 
 // Global pointer for backwards compatibility
@@ -32,11 +33,15 @@ public:
 
     void initialize(TextureManager& textures, sf::RenderWindow& window);
     void update(float deltaTime);
-    void render(sf::RenderWindow& window);
+    // Loads and unloads level chunks around the camera; call before update()
+    void updateLevelStreaming(const sf::View& camera);
+    // Submits visible entities to the frame's render queue
+    void render(RenderQueue& queue, const sf::View& view);
 
     // Simple delegation to managers - no business logic here!
     PlayerEntity* getPlayer();
     EntityManager& getEntityManager() { return m_entityManager; }
+    const RenderSystem& getRenderSystem() const { return m_renderSystem; }
     void spawnEntity(std::unique_ptr<Entity> entity);
 
     // Level operations (delegated to GameLevelManager)
@@ -65,6 +70,7 @@ private:
     RenderSystem m_renderSystem;
 
     std::unique_ptr<SurpriseBoxManager> m_surpriseBoxManager;
+    std::unique_ptr<EventTapeRecorder> m_eventTape;   // Only when EVENT_TAPE is set
 
     // Simple cache for quick access
     PlayerEntity* m_player = nullptr;
@@ -2,6 +2,7 @@
 #include <SFML/Graphics.hpp>
 #include <memory>
 #include <string>
+#include <vector>
 #include "IScreen.h"
 #include "GameSession.h"
 #include "CameraManager.h"
@@ -11,6 +12,8 @@
 #include "ResourceManager.h"
 #include "Entity.h"  // Added for Entity class
 #include <DarkLevelSystem.h>
+#include "RenderQueue.h"
+#include "RenderCommandList.h"
 
 // Forward declarations
 class UIObserver;
@@ -34,6 +37,7 @@ public:
     void handleEvents(sf::RenderWindow& window) override;
     void update(float deltaTime) override;
     void render(sf::RenderWindow& window) override;
+    bool record(RenderCommandList& commands, sf::RenderWindow& window) override;
 
     // Lifecycle hooks
     void onEnter() override {}
@@ -52,13 +56,16 @@ private:
     InputService m_inputService;
     
     // Resources
-    ResourceManager<sf::Texture> m_textures;
+    TextureManager& m_textures;  ///< Shared application cache (atlas regions are keyed by its textures)
     sf::RenderWindow* m_window = nullptr;
+    RenderQueue m_renderQueue;  ///< Rebuilt and flushed every frame
+    RenderCommandList m_directCommands;  ///< Used by render() when no render thread is running
     sf::Font m_font;
     
     // UI elements
     sf::Text m_levelCompleteText;
     sf::Text m_gameCompleteText;
+    int m_gameCompleteScore = -1;   // Score currently laid out in m_gameCompleteText
     sf::Text m_gameOverText;
     sf::RectangleShape m_messageBackground;
     sf::RectangleShape m_gameOverBackground;
@@ -80,6 +87,8 @@ private:
     float m_helpTimer = 0.0f;
     const float m_helpDuration = 3.0f;
     sf::Sprite m_helpSprite;
+
+    std::vector<EventSubscription> m_eventSubscriptions;  ///< Level event handlers, dropped with the screen
     
     // Initialization methods
     void initializeComponents();
@@ -116,7 +125,7 @@ private:
     bool isPlayerValid(PlayerEntity* player);
     
     // Rendering methods
-    void renderGameMessages(sf::RenderWindow& window);
+    void renderGameMessages(RenderCommandList& commands);
     
     // Component safety helpers
     template <typename T>
@@ -1,9 +1,12 @@
 #pragma once
-#include <typeindex>
-#include <unordered_map>
-#include <vector>
-#include <functional>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "InlineFunction.h"
 
 /**
  * Base class for all game events
@@ -15,75 +18,329 @@ public:
 };
 
 /**
- * Event listener interface
+ * Dense index per event type, used to find a type's handlers without hashing.
+ * Each type gets the next free index the first time it is used; after that
+ * the lookup is a single static load.
  */
-class IEventListener {
+class EventTypeId {
 public:
-    virtual ~IEventListener() = default;
+    template<typename TEvent>
+    static std::size_t of() {
+        static const std::size_t id = s_next++;
+        return id;
+    }
+
+private:
+    inline static std::size_t s_next = 0;
 };
 
 /**
- * Typed event listener
+ * Handle to one subscription. Unsubscribes when destroyed, so an object
+ * that keeps its handles as members can never be called after it is gone.
  */
-template<typename TEvent>
-class EventListener : public IEventListener {
+class EventSubscription {
 public:
-    using Handler = std::function<void(const TEvent&)>;
-
-    EventListener(Handler handler) : m_handler(handler) {}
+    EventSubscription() = default;
+    EventSubscription(EventSubscription&& other) noexcept;
+    EventSubscription& operator=(EventSubscription&& other) noexcept;
+    EventSubscription(const EventSubscription&) = delete;
+    EventSubscription& operator=(const EventSubscription&) = delete;
+    ~EventSubscription();
 
-    void handle(const Event& event) {
-        m_handler(static_cast<const TEvent&>(event));
-    }
+    // Unsubscribe now
+    void reset();
+    bool isActive() const { return m_id != 0; }
 
 private:
-    Handler m_handler;
+    friend class EventSystem;
+    EventSubscription(std::size_t typeId, std::uint32_t id) : m_typeId(typeId), m_id(id) {}
+
+    std::size_t m_typeId = 0;
+    std::uint32_t m_id = 0;
 };
 
 /**
  * Event System - Central event dispatcher
  * Implements Observer Pattern from course material
+ *
+ * Handlers are stored per event type in a vector indexed by EventTypeId, as
+ * inline callables with no heap allocation. publish() walks that vector
+ * directly: no hashing, no allocation and one indirect call per handler.
+ *
+ * publish() delivers immediately. enqueue() only appends the event to a
+ * contiguous per-type buffer; dispatchQueued() later hands each buffer to
+ * the batch handlers as one span and to the regular handlers one event at
+ * a time. Events raised inside collision or physics callbacks should be
+ * queued, so their handlers never run in the middle of that iteration.
+ * Order is kept within a type, not across types.
+ *
+ * Handlers may subscribe and unsubscribe while an event is being delivered;
+ * the changes take effect once the delivery has finished.
  */
 class EventSystem {
 public:
-    static EventSystem& getInstance();
+    static constexpr std::size_t HANDLER_CAPACITY = 48;  // Bytes a handler may capture
 
-    // Subscribe to events
     template<typename TEvent>
-    void subscribe(std::function<void(const TEvent&)> handler);
+    using Handler = InlineFunction<void(const TEvent&), HANDLER_CAPACITY>;
+    template<typename TEvent>
+    using BatchHandler = InlineFunction<void(std::span<const TEvent>), HANDLER_CAPACITY>;
+
+    static EventSystem& getInstance();
+
+    // Subscribe to events; the subscription lasts as long as the returned handle
+    template<typename TEvent, typename F>
+    [[nodiscard]] EventSubscription subscribe(F&& handler);
+
+    // Subscribe to queued events, delivered as one span per dispatch
+    template<typename TEvent, typename F>
+    [[nodiscard]] EventSubscription subscribeBatch(F&& handler);
 
     // Publish events
     template<typename TEvent>
     void publish(const TEvent& event);
 
-    // Clear all listeners
+    // Queue an event for the next dispatchQueued()
+    template<typename TEvent>
+    void enqueue(const TEvent& event);
+
+    // Deliver queued events; events queued by handlers are delivered in the same call
+    void dispatchQueued();
+
+    // Drop queued events without delivering them
+    void discardQueued();
+
+    // Number of events waiting for dispatchQueued()
+    std::size_t getQueuedCount() const;
+
+    // Clear all handlers and queued events; outstanding handles become no-ops
     void clear();
 
 private:
+    friend class EventSubscription;
     EventSystem() = default;
 
-    using ListenerList = std::vector<std::unique_ptr<IEventListener>>;
-    std::unordered_map<std::type_index, ListenerList> m_listeners;
+    void unsubscribe(std::size_t typeId, std::uint32_t id);
+
+    /**
+     * Type-erased handlers and queue of one event type
+     */
+    class IChannel {
+    public:
+        virtual ~IChannel() = default;
+        virtual std::size_t queuedCount() const = 0;
+        virtual void dispatchQueued() = 0;
+        virtual void discardQueued() = 0;
+        virtual void remove(std::uint32_t id) = 0;
+
+        bool inQueueOrder = false;
+    };
+
+    template<typename TEvent>
+    class Channel : public IChannel {
+    public:
+        void add(std::uint32_t id, Handler<TEvent>&& handler);
+        void addBatch(std::uint32_t id, BatchHandler<TEvent>&& handler);
+        void remove(std::uint32_t id) override;
+
+        void publish(const TEvent& event);
+        void dispatchQueued() override;
+        void discardQueued() override { m_pending.clear(); }
+        std::size_t queuedCount() const override { return m_pending.size(); }
+
+        void enqueue(const TEvent& event) { m_pending.push_back(event); }
+
+    private:
+        template<typename TCallable>
+        struct Slot {
+            std::uint32_t id;  // 0 once unsubscribed during a delivery
+            TCallable call;
+        };
+
+        // Marks a delivery in progress; ends it even if a handler throws
+        struct DeliveryScope {
+            explicit DeliveryScope(Channel& channel) : channel(channel) { ++channel.m_deliveryDepth; }
+            ~DeliveryScope() { channel.endDelivery(); }
+            DeliveryScope(const DeliveryScope&) = delete;
+            DeliveryScope& operator=(const DeliveryScope&) = delete;
+
+            Channel& channel;
+        };
+
+        template<typename TSlot>
+        static void removeFrom(std::vector<TSlot>& slots, std::uint32_t id, bool deliveryInProgress, bool& hasDead);
+        void endDelivery();
+
+        std::vector<Slot<Handler<TEvent>>> m_handlers;
+        std::vector<Slot<BatchHandler<TEvent>>> m_batchHandlers;
+        std::vector<Slot<Handler<TEvent>>> m_addedHandlers;        // Subscribed during a delivery
+        std::vector<Slot<BatchHandler<TEvent>>> m_addedBatchHandlers;
+        int m_deliveryDepth = 0;
+        bool m_hasDead = false;
+
+        std::vector<TEvent> m_pending;      // Filled by enqueue()
+        std::vector<TEvent> m_dispatching;  // Swapped in while handlers run
+    };
+
+    template<typename TEvent>
+    Channel<TEvent>& channel();
+
+    template<typename TEvent>
+    Channel<TEvent>* findChannel();
+
+    std::vector<std::unique_ptr<IChannel>> m_channels;  // Indexed by EventTypeId
+    std::vector<IChannel*> m_queueOrder;                // Dispatch order: first queued type first
+    std::uint32_t m_nextSubscriptionId = 1;
 };
 
 // Template implementations
-template<typename TEvent>
-void EventSystem::subscribe(std::function<void(const TEvent&)> handler) {
+template<typename TEvent, typename F>
+EventSubscription EventSystem::subscribe(F&& handler) {
     static_assert(std::is_base_of<Event, TEvent>::value, "TEvent must derive from Event");
 
-    auto listener = std::make_unique<EventListener<TEvent>>(handler);
-    m_listeners[typeid(TEvent)].push_back(std::move(listener));
+    std::uint32_t id = m_nextSubscriptionId++;
+    channel<TEvent>().add(id, Handler<TEvent>(std::forward<F>(handler)));
+    return EventSubscription(EventTypeId::of<TEvent>(), id);
+}
+
+template<typename TEvent, typename F>
+EventSubscription EventSystem::subscribeBatch(F&& handler) {
+    static_assert(std::is_base_of<Event, TEvent>::value, "TEvent must derive from Event");
+
+    std::uint32_t id = m_nextSubscriptionId++;
+    channel<TEvent>().addBatch(id, BatchHandler<TEvent>(std::forward<F>(handler)));
+    return EventSubscription(EventTypeId::of<TEvent>(), id);
 }
 
 template<typename TEvent>
 void EventSystem::publish(const TEvent& event) {
     static_assert(std::is_base_of<Event, TEvent>::value, "TEvent must derive from Event");
 
-    auto it = m_listeners.find(typeid(TEvent));
-    if (it != m_listeners.end()) {
-        for (auto& listener : it->second) {
-            auto* typedListener = static_cast<EventListener<TEvent>*>(listener.get());
-            typedListener->handle(event);
+    if (auto* typed = findChannel<TEvent>()) {
+        typed->publish(event);
+    }
+}
+
+template<typename TEvent>
+void EventSystem::enqueue(const TEvent& event) {
+    static_assert(std::is_base_of<Event, TEvent>::value, "TEvent must derive from Event");
+
+    Channel<TEvent>& typed = channel<TEvent>();
+    if (!typed.inQueueOrder) {
+        typed.inQueueOrder = true;
+        m_queueOrder.push_back(&typed);
+    }
+    typed.enqueue(event);
+}
+
+template<typename TEvent>
+EventSystem::Channel<TEvent>* EventSystem::findChannel() {
+    const std::size_t id = EventTypeId::of<TEvent>();
+    return id < m_channels.size() ? static_cast<Channel<TEvent>*>(m_channels[id].get()) : nullptr;
+}
+
+template<typename TEvent>
+EventSystem::Channel<TEvent>& EventSystem::channel() {
+    const std::size_t id = EventTypeId::of<TEvent>();
+    if (id >= m_channels.size()) {
+        m_channels.resize(id + 1);
+    }
+    if (!m_channels[id]) {
+        m_channels[id] = std::make_unique<Channel<TEvent>>();
+    }
+    return static_cast<Channel<TEvent>&>(*m_channels[id]);
+}
+
+template<typename TEvent>
+void EventSystem::Channel<TEvent>::add(std::uint32_t id, Handler<TEvent>&& handler) {
+    auto& slots = m_deliveryDepth > 0 ? m_addedHandlers : m_handlers;
+    slots.push_back({ id, std::move(handler) });
+}
+
+template<typename TEvent>
+void EventSystem::Channel<TEvent>::addBatch(std::uint32_t id, BatchHandler<TEvent>&& handler) {
+    auto& slots = m_deliveryDepth > 0 ? m_addedBatchHandlers : m_batchHandlers;
+    slots.push_back({ id, std::move(handler) });
+}
+
+template<typename TEvent>
+template<typename TSlot>
+void EventSystem::Channel<TEvent>::removeFrom(std::vector<TSlot>& slots, std::uint32_t id,
+    bool deliveryInProgress, bool& hasDead) {
+    for (auto it = slots.begin(); it != slots.end(); ++it) {
+        if (it->id != id) {
+            continue;
+        }
+        // A handler may be removing itself; destroy it only after the delivery
+        if (deliveryInProgress) {
+            it->id = 0;
+            hasDead = true;
+        }
+        else {
+            slots.erase(it);
+        }
+        return;
+    }
+}
+
+template<typename TEvent>
+void EventSystem::Channel<TEvent>::remove(std::uint32_t id) {
+    const bool delivering = m_deliveryDepth > 0;
+    removeFrom(m_handlers, id, delivering, m_hasDead);
+    removeFrom(m_batchHandlers, id, delivering, m_hasDead);
+    removeFrom(m_addedHandlers, id, false, m_hasDead);
+    removeFrom(m_addedBatchHandlers, id, false, m_hasDead);
+}
+
+template<typename TEvent>
+void EventSystem::Channel<TEvent>::endDelivery() {
+    if (--m_deliveryDepth > 0) {
+        return;
+    }
+    if (m_hasDead) {
+        std::erase_if(m_handlers, [](const auto& slot) { return slot.id == 0; });
+        std::erase_if(m_batchHandlers, [](const auto& slot) { return slot.id == 0; });
+        m_hasDead = false;
+    }
+    for (auto& slot : m_addedHandlers) {
+        m_handlers.push_back(std::move(slot));
+    }
+    for (auto& slot : m_addedBatchHandlers) {
+        m_batchHandlers.push_back(std::move(slot));
+    }
+    m_addedHandlers.clear();
+    m_addedBatchHandlers.clear();
+}
+
+template<typename TEvent>
+void EventSystem::Channel<TEvent>::publish(const TEvent& event) {
+    // The vector cannot grow while it is walked: new handlers wait in m_addedHandlers
+    DeliveryScope delivery(*this);
+    for (auto& slot : m_handlers) {
+        if (slot.id != 0) {
+            slot.call(event);
+        }
+    }
+}
+
+template<typename TEvent>
+void EventSystem::Channel<TEvent>::dispatchQueued() {
+    // Handlers may queue more events of this type; they land in m_pending
+    m_dispatching.clear();
+    m_dispatching.swap(m_pending);
+    std::span<const TEvent> events(m_dispatching);
+
+    DeliveryScope delivery(*this);
+    for (auto& slot : m_batchHandlers) {
+        if (slot.id != 0) {
+            slot.call(events);
+        }
+    }
+    for (const TEvent& event : events) {
+        for (auto& slot : m_handlers) {
+            if (slot.id != 0) {
+                slot.call(event);
+            }
         }
     }
 }
\ No newline at end of file
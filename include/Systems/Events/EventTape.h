@@ -0,0 +1,75 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+/**
+ * Binary layout of an event tape, shared by EventTapeRecorder and the
+ * event_tape_decoder tool. All values are little-endian.
+ *
+ *   Header:  "EVTP" | u16 version | u16 type count
+ *            type count x (u8 type id | u8 name length | name bytes)
+ *   Records: u8 type id | u16 payload size | u32 frame | u64 microseconds
+ *            since recording started | payload
+ *
+ * Type id 0 is never written, so a zero byte where a record should start
+ * marks the end of the tape (a file that was not closed cleanly keeps the
+ * zero-filled tail of its mapping).
+ */
+namespace EventTape {
+    constexpr char MAGIC[4] = { 'E', 'V', 'T', 'P' };
+    constexpr std::uint16_t VERSION = 1;
+    constexpr std::size_t RECORD_HEADER_SIZE = 1 + 2 + 4 + 8;
+
+    enum class Type : std::uint8_t {
+        End = 0,
+        ScoreChanged,
+        PlayerDied,
+        ItemCollected,
+        EnemyKilled,
+        LevelCompleted,
+        PlayerStateChanged,
+        CoinCollected,
+        FlagReached,
+        LevelTransition,
+        WellEntered,
+        LevelParsed,
+        Count
+    };
+
+    struct RecordHeader {
+        Type type = Type::End;
+        std::uint16_t payloadSize = 0;
+        std::uint32_t frame = 0;
+        std::uint64_t micros = 0;
+    };
+
+    // Little-endian field access; the game only targets little-endian machines
+    template<typename T>
+    void write(std::uint8_t* out, T value) {
+        std::memcpy(out, &value, sizeof(T));
+    }
+
+    template<typename T>
+    T read(const std::uint8_t* in) {
+        T value;
+        std::memcpy(&value, in, sizeof(T));
+        return value;
+    }
+
+    inline void writeRecordHeader(std::uint8_t* out, const RecordHeader& header) {
+        out[0] = static_cast<std::uint8_t>(header.type);
+        write(out + 1, header.payloadSize);
+        write(out + 3, header.frame);
+        write(out + 7, header.micros);
+    }
+
+    inline RecordHeader readRecordHeader(const std::uint8_t* in) {
+        RecordHeader header;
+        header.type = static_cast<Type>(in[0]);
+        header.payloadSize = read<std::uint16_t>(in + 1);
+        header.frame = read<std::uint32_t>(in + 3);
+        header.micros = read<std::uint64_t>(in + 7);
+        return header;
+    }
+}
\ No newline at end of file
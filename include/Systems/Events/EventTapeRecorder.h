@@ -0,0 +1,68 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "EventSystem.h"
+#include "EventTape.h"
+#include "MappedFile.h"
+
+/**
+ * @class EventTapeRecorder
+ * @brief Records every gameplay event into a binary tape file (see EventTape.h).
+ *
+ * The recorder subscribes to each event type in GameEvents.h. Handlers only
+ * append a few bytes to an in-memory buffer; beginFrame() hands the buffer to
+ * a writer thread, which copies it into a memory-mapped file that grows as
+ * needed. Decode tapes with the event_tape_decoder tool.
+ *
+ * GameSession creates a recorder when the EVENT_TAPE environment variable
+ * names an output file.
+ */
+class EventTapeRecorder {
+public:
+    explicit EventTapeRecorder(const std::string& path);
+    ~EventTapeRecorder();
+    EventTapeRecorder(const EventTapeRecorder&) = delete;
+    EventTapeRecorder& operator=(const EventTapeRecorder&) = delete;
+
+    bool isRecording() const { return m_recording; }
+
+    /**
+     * @brief Starts the next frame and passes the previous frame's records to the writer.
+     */
+    void beginFrame();
+
+    std::uint64_t getEventCount() const { return m_eventCount; }
+
+private:
+    class PayloadWriter;
+
+    template<typename TEvent, typename Encode>
+    void track(EventTape::Type type, Encode encode);
+
+    void writeHeader();
+    void writerLoop();
+
+    MappedFile m_file;
+    std::string m_path;
+    std::size_t m_used = 0;             // Bytes of the mapping filled so far (writer thread)
+    std::atomic<bool> m_recording{ false };     // Cleared by the writer if the file cannot grow; then beginFrame() unsubscribes
+
+    std::vector<std::uint8_t> m_frameRecords;   // Appended by event handlers
+    std::vector<std::uint8_t> m_pending;        // Handed over, not yet written
+    std::mutex m_mutex;
+    std::condition_variable m_wake;
+    bool m_stopping = false;
+    std::thread m_writer;
+
+    std::uint32_t m_frame = 0;
+    std::uint64_t m_eventCount = 0;
+    std::uint64_t m_droppedCount = 0;           // Records whose payload did not fit the u16 size
+    std::chrono::steady_clock::time_point m_start;
+    std::vector<EventSubscription> m_subscriptions;
+};
\ No newline at end of file
@@ -29,6 +29,8 @@ private:
     bool m_initialized = false;
     std::function<void(const LevelCompletedEvent&)> m_levelCompleteHandler;
     std::function<void(const PlayerDiedEvent&)> m_playerDeathHandler;
+    EventSubscription m_levelCompleteSubscription;
+    EventSubscription m_playerDeathSubscription;
 
     void setupDefaultHandlers();
 };
\ No newline at end of file
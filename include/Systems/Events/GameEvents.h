@@ -159,4 +159,21 @@ public:
     Entity::IdType playerId;
     Entity::IdType wellId;
     std::string targetLevel;
+};
+
+/**
+ * Level parsed event - posted from the parse thread through ThreadEventChannel
+ */
+class LevelParsedEvent : public Event {
+public:
+    LevelParsedEvent(const std::string& levelPath, std::size_t spawnCount, float parseMs, bool ok)
+        : levelPath(levelPath), spawnCount(spawnCount), parseMs(parseMs), ok(ok) {
+    }
+
+    const char* getName() const override { return "LevelParsed"; }
+
+    std::string levelPath;
+    std::size_t spawnCount;
+    float parseMs;
+    bool ok;
 };
\ No newline at end of file
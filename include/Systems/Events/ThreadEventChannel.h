@@ -0,0 +1,111 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <type_traits>
+#include "EventSystem.h"
+#include "InlineFunction.h"
+
+/**
+ * @class ThreadEventChannel
+ * @brief Lock-free bounded channel for sending events from worker threads to the game thread.
+ *
+ * EventSystem is not thread-safe, so worker threads (asset loading, jobs,
+ * audio) post() into this channel instead. Any number of threads may post;
+ * only the game thread drains, once at the start of each frame, and the
+ * drained events are published through the normal EventSystem.
+ *
+ * The ring has a fixed number of slots, each with a sequence number that
+ * tells producers and the consumer whose turn it is (a bounded MPMC queue
+ * reduced to one consumer). Posting copies the event into the slot; nothing
+ * is allocated after construction.
+ *
+ * When the ring is full the overflow policy decides: DropNewest rejects the
+ * event and counts it, Block makes the producer yield until a slot frees up.
+ * The game thread itself never blocks on its own channel; it drops instead.
+ */
+class ThreadEventChannel {
+public:
+    enum class Overflow {
+        DropNewest,
+        Block
+    };
+
+    struct Stats {
+        std::uint64_t posted = 0;      ///< Accepted into the ring.
+        std::uint64_t delivered = 0;   ///< Published on the game thread.
+        std::uint64_t dropped = 0;     ///< Rejected because the ring was full.
+        std::uint64_t blocked = 0;     ///< Posts that had to wait for a free slot.
+        std::uint64_t late = 0;        ///< Delivered later than the late threshold after posting.
+    };
+
+    using Clock = std::chrono::steady_clock;
+    static constexpr std::size_t EVENT_CAPACITY = 96;  // Bytes an event may occupy in a slot
+
+    /**
+     * @param capacity Slots in the ring, rounded up to a power of two.
+     * @param lateThreshold Age after which a delivered event counts as late.
+     */
+    explicit ThreadEventChannel(std::size_t capacity = 1024, Overflow overflow = Overflow::DropNewest,
+        Clock::duration lateThreshold = std::chrono::milliseconds(50));
+    ThreadEventChannel(const ThreadEventChannel&) = delete;
+    ThreadEventChannel& operator=(const ThreadEventChannel&) = delete;
+
+    static ThreadEventChannel& getInstance();
+
+    /**
+     * @brief Posts an event from any thread.
+     * @return false if the event was dropped because the ring was full.
+     */
+    template<typename TEvent>
+    bool post(const TEvent& event);
+
+    /**
+     * @brief Publishes every posted event to the event system. Game thread only.
+     *
+     * Stops after one ring's worth of events so producers that keep posting
+     * cannot hold the frame. Returns the number of events delivered.
+     */
+    std::size_t drain(EventSystem& events);
+
+    Stats getStats() const;
+    std::size_t getCapacity() const { return m_mask + 1; }
+
+private:
+    using Delivery = InlineFunction<void(EventSystem&), EVENT_CAPACITY>;
+
+    struct alignas(64) Slot {
+        std::atomic<std::size_t> sequence{ 0 };
+        Delivery deliver;
+        Clock::time_point postedAt;
+    };
+
+    bool push(Delivery&& deliver);
+
+    std::unique_ptr<Slot[]> m_slots;
+    std::size_t m_mask = 0;
+    Overflow m_overflow;
+    Clock::duration m_lateThreshold;
+
+    alignas(64) std::atomic<std::size_t> m_enqueuePos{ 0 };
+    alignas(64) std::size_t m_dequeuePos = 0;            // Touched by the game thread only
+    std::atomic<std::thread::id> m_consumer;              // Thread that last drained
+
+    std::atomic<std::uint64_t> m_posted{ 0 };
+    std::atomic<std::uint64_t> m_delivered{ 0 };
+    std::atomic<std::uint64_t> m_dropped{ 0 };
+    std::atomic<std::uint64_t> m_blocked{ 0 };
+    std::atomic<std::uint64_t> m_late{ 0 };
+};
+
+// Template implementation
+template<typename TEvent>
+bool ThreadEventChannel::post(const TEvent& event) {
+    static_assert(std::is_base_of<Event, TEvent>::value, "TEvent must derive from Event");
+
+    // Init-capture stores a non-const copy, which keeps the slot nothrow movable
+    return push(Delivery([copy = TEvent(event)](EventSystem& events) { events.publish(copy); }));
+}
\ No newline at end of file
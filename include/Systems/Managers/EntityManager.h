@@ -9,6 +9,18 @@ class EntityManager {
 public:
     using IdType = Entity::IdType;
 
+    /**
+     * Receives notifications when entities enter or leave the manager,
+     * so systems can keep their own indices without rescanning every frame.
+     */
+    class Listener {
+    public:
+        virtual ~Listener() = default;
+        virtual void onEntityAdded(Entity* entity) = 0;
+        // Called before the entity is destroyed
+        virtual void onEntityRemoved(Entity* entity) = 0;
+    };
+
     EntityManager();
     ~EntityManager();
 
@@ -45,10 +57,17 @@ public:
      */
     IdType generateId();
 
+    // Lifecycle listeners (not owned)
+    void addListener(Listener* listener);
+    void removeListener(Listener* listener);
 
 private:
     std::unordered_map<IdType, std::unique_ptr<Entity>> m_entities;
     IdType m_nextId = 1;
+    std::vector<Listener*> m_listeners;
+
+    void notifyAdded(Entity* entity);
+    void notifyRemoved(Entity* entity);
 };
 
 template <typename T, typename... Args>
@@ -58,5 +77,6 @@ T* EntityManager::createEntity(Args&&... args) {
         auto entity = std::make_unique<T>(id, std::forward<Args>(args)...);
         T* ptr = entity.get();
         m_entities[id] = std::move(entity);
+        notifyAdded(ptr);
         return ptr;
 }
\ No newline at end of file
@@ -4,9 +4,11 @@
 #include "EventSystem.h"
 #include "GameEvents.h"
 #include <memory>
+#include <vector>
 #include "EntityManager.h"
 #include "PhysicsManager.h"
 #include "ResourceManager.h"
+#include "LevelStreamer.h"
 
 /**
  * GameLevelManager - Single Responsibility: Handle all level operations
@@ -38,6 +40,15 @@ public:
     void setupEventHandlers();
     void update(float deltaTime); // For transition timing
 
+    // Streaming: levels are instantiated chunk by chunk around the camera
+    void setStreamingEnabled(bool enabled) { m_streamingEnabled = enabled; }
+    bool isStreamingEnabled() const { return m_streamingEnabled; }
+    void updateStreaming(const sf::View& camera);
+    const LevelStreamer* getStreamer() const { return m_streamer.get(); }
+
+    // Parses a level in the background so a later loadLevel of it does not stall
+    void preloadLevel(const std::string& levelPath);
+
 private:
     LevelManager m_levelManager;
     LevelLoader m_levelLoader;
@@ -52,6 +63,11 @@ private:
     void onLevelTransition(const LevelTransitionEvent& event);
 
     void onWellEntered(const WellEnteredEvent& event);
+    void onLevelParsed(const LevelParsedEvent& event);
+
+    bool restartLevel();
+    void ensurePlayer();
+    std::string getUpcomingLevelPath() const;
 
     // Level transition state
     bool m_transitionPending = false;
@@ -59,4 +75,10 @@ private:
     float m_transitionDelay = 2.0f;
     std::string m_nextLevelPath;
     bool m_needLevelSwitch = false;
+
+    std::vector<EventSubscription> m_subscriptions;
+
+    std::unique_ptr<LevelStreamer> m_streamer;
+    bool m_streamingEnabled = true;
+    float m_switchMs = 0.0f;       // Main-thread time of the last loadLevel, reported with the streaming startup
 };
\ No newline at end of file
@@ -65,6 +65,12 @@ public:
      */
     bool hasNextLevel() const;
 
+    /**
+     * @brief Gets the path of the level after the current one.
+     * @return The next level path, or an empty string at the last level.
+     */
+    std::string getNextLevelPath() const;
+
     /**
      * @brief Resets the level index to the first level.
      */
@@ -0,0 +1,175 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <array>
+#include <cstdint>
+#include <future>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "CompiledLevel.h"
+#include "EntityFactory.h"
+#include "EntityManager.h"
+
+class LevelLoader;
+
+/**
+ * @class LevelStreamer
+ * @brief Instantiates a level chunk by chunk around the camera instead of all at once.
+ *
+ * The level is split into chunks of CHUNK_COLUMNS tile columns. start() parses
+ * the spawn list on a background thread; update() then creates the entities
+ * of chunks near the camera and destroys those of chunks that fall far
+ * behind (or far ahead, when walking back). Live entities therefore depend on
+ * the view width, not on the level length; what stays per level is the spawn
+ * list (8 bytes per spawn) and one bit per spawn of delta.
+ *
+ * The delta records spawns that must not come back when their chunk is
+ * reloaded: anything that was removed from the EntityManager, or was
+ * inactive, while its chunk was loaded (collected coins, killed enemies,
+ * opened boxes).
+ *
+ * An entity belongs to the chunk it is in when that chunk unloads, not to
+ * the one it spawned in. If it has moved into another loaded chunk (a chasing
+ * enemy, a pushed box) it is handed over and stays alive. Otherwise it is
+ * destroyed; if it had moved more than half a tile, its spawn is relocated to
+ * the chunk under its current position and recreated there. Recreation
+ * rebuilds the entity from its type, so per-instance state such as health
+ * is not kept.
+ */
+class LevelStreamer : public EntityManager::Listener {
+public:
+    static constexpr std::uint32_t CHUNK_COLUMNS = 16;
+    static constexpr int LOAD_BEHIND = 1;       // Chunks kept loaded left of the view
+    static constexpr int LOAD_AHEAD = 2;        // Chunks loaded right of the view
+    static constexpr int UNLOAD_SLACK = 2;      // Extra chunks before unloading, so edges do not thrash
+
+    LevelStreamer(EntityManager& entities, const LevelLoader& loader);
+    ~LevelStreamer() override;
+    LevelStreamer(const LevelStreamer&) = delete;
+    LevelStreamer& operator=(const LevelStreamer&) = delete;
+
+    /**
+     * @brief Starts parsing a level in the background. Nothing is created until update().
+     */
+    void start(const std::string& path);
+
+    /**
+     * @brief Parses a level that is likely to be loaded next while the current one plays.
+     *
+     * A later start() with the same path takes the parsed spawn list instead
+     * of reading the file again. Only one level is preloaded at a time; a
+     * superseded parse is left to finish in the background, never waited on.
+     */
+    void preload(const std::string& path);
+
+    /**
+     * @brief Forgets the current level. Its entities are left to the caller to clear.
+     */
+    void stop();
+
+    /**
+     * @brief Clears every entity and puts the level back to its initial state.
+     *
+     * The spawn list parsed by start() is the level's initial-state snapshot:
+     * each entity's components and body follow from its type and position.
+     * Restarting drops the delta and lets update() recreate the chunks around
+     * the camera, without touching the file. Returns false if no level is active.
+     */
+    bool restart();
+
+    bool isActive() const { return m_active; }
+
+    /**
+     * @brief True if the parsed level places at least one entity of this type.
+     */
+    bool hasSpawnType(char type) const;
+
+    const std::string& getPath() const { return m_path; }
+
+    /**
+     * @brief Loads and unloads chunks around the view. Waits for the parse if no chunk is loaded yet.
+     */
+    void update(const sf::View& camera);
+
+    std::size_t getChunkCount() const { return m_chunks.size(); }
+    std::size_t getLoadedChunkCount() const { return m_loaded.size(); }
+    std::size_t getLiveEntityCount() const { return m_liveSpawns.size(); }
+
+    /**
+     * @brief Main-thread cost of bringing a started level on screen.
+     */
+    struct StartupStats {
+        float parseWaitMs = 0.0f;      ///< Time spent waiting for the spawn list.
+        float instantiateMs = 0.0f;    ///< Time spent creating the first chunks.
+        bool preloaded = false;        ///< The spawn list came from preload().
+        bool restarted = false;        ///< Restored by restart() rather than started.
+    };
+
+    /**
+     * @brief Returns true once per start(), after the first chunks were created.
+     */
+    bool takeStartupStats(StartupStats& stats);
+
+    // EntityManager::Listener
+    void onEntityAdded(Entity*) override {}
+    void onEntityRemoved(Entity* entity) override;
+
+private:
+    struct ParsedLevel {
+        bool ok = false;
+        std::vector<CompiledLevel::Spawn> spawns;  // Sorted by column
+    };
+
+    struct Relocation {
+        std::uint32_t spawn = 0;
+        sf::Vector2f position;                     // Creator position for the entity's new place
+    };
+
+    struct Chunk {
+        std::uint32_t firstSpawn = 0;
+        std::uint32_t spawnCount = 0;
+        std::vector<std::uint64_t> removed;        // Delta: one bit per spawn, allocated on first use
+        std::vector<Relocation> relocated;         // Spawns from other chunks that moved here
+        std::vector<Entity::IdType> entities;      // Held while loaded; may include removed ids
+        bool loaded = false;
+    };
+
+    struct LiveSpawn {
+        std::uint32_t spawn = 0;
+        sf::Vector2f created;                      // Position given to the creator
+        sf::Vector2f origin;                       // Transform position right after creation
+        bool relocated = false;                    // Created from a Relocation, not the spawn list
+    };
+
+    bool takeParsedLevel(bool wait);
+    std::future<ParsedLevel> parseAsync(const std::string& path) const;
+    void retire(std::future<ParsedLevel> parse);
+    void loadChunk(std::size_t index);
+    void unloadChunk(std::size_t index);
+    bool spawnEntity(std::size_t index, std::uint32_t spawnIndex, const sf::Vector2f& position, bool relocated);
+    std::size_t chunkAt(float x) const;
+    void markRemoved(std::uint32_t spawnIndex);
+    void clearRemoved(std::uint32_t spawnIndex);
+    bool isRemoved(const Chunk& chunk, std::uint32_t offset) const;
+    const EntityFactory::CreatorFunc* creatorFor(char type);
+
+    EntityManager& m_entities;
+    const LevelLoader& m_loader;
+
+    bool m_active = false;
+    bool m_unloading = false;                      // Our own destroyEntity calls are not removals
+    std::string m_path;
+    std::future<ParsedLevel> m_parse;
+    std::future<ParsedLevel> m_preload;
+    std::string m_preloadPath;
+    std::vector<std::future<ParsedLevel>> m_retired;   // Abandoned parses, kept until they finish
+    StartupStats m_startup;
+    bool m_startupPending = false;                 // Started, first chunks not created yet
+    bool m_startupReady = false;                   // Stats waiting for takeStartupStats()
+    std::vector<CompiledLevel::Spawn> m_spawns;
+    std::vector<Chunk> m_chunks;
+    std::vector<std::size_t> m_loaded;             // Indices of loaded chunks
+    std::unordered_map<Entity::IdType, LiveSpawn> m_liveSpawns;
+
+    std::array<bool, 256> m_missingReported{};     // Types already logged as unregistered
+};
\ No newline at end of file
@@ -6,6 +6,7 @@
 #include "ResourceManager.h"  
 #include "SurpriseBoxScreen.h"
 #include "Entity.h"
+#include "EventSystem.h"
 #include <box2d/b2_body.h>
  
 class EntityManager;
@@ -48,4 +49,5 @@ private:
 
     std::unique_ptr<SurpriseBoxScreen> m_surpriseScreen;
     std::mt19937 m_gen;
+    EventSubscription m_coinSubscription;  // Released before the members its handler uses
 };
\ No newline at end of file
@@ -1,16 +1,34 @@
 #pragma once
 #include <SFML/Graphics.hpp>
+#include <string>
+#include <vector>
 #include "ResourceManager.h"
+#include "RenderCommandList.h"
 
+/**
+ * BackgroundRenderer - Draws the endlessly repeating level background.
+ *
+ * Each layer is a single textured quad covering the camera: the texture is set
+ * to repeat and the quad's texture coordinates scroll with the camera, so the
+ * GPU tiles the image instead of drawing one sprite per copy. Extra layers can
+ * be added with a parallax factor (1 = fixed to the world, 0 = fixed to the screen).
+ */
 class BackgroundRenderer {
 public:
     BackgroundRenderer(TextureManager& textures);
 
-    void render(sf::RenderWindow& window, const sf::View& camera) const;
+    void render(RenderCommandList& commands, const sf::View& camera) const;
+
+    // Adds a layer drawn over the previous ones, scaled to the window height
+    void addLayer(const std::string& filename, float parallax);
 
 private:
-    sf::Texture m_backgroundTexture;
-    sf::Sprite m_backgroundSprite;
+    struct Layer {
+        sf::Texture* texture;
+        float scale;      // World units per texture pixel
+        float parallax;
+    };
 
-    void setupBackground();
+    TextureManager& m_textures;
+    std::vector<Layer> m_layers;
 };
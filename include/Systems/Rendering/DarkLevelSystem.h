@@ -1,24 +1,34 @@
 ﻿#pragma once
 #include <SFML/Graphics.hpp>
 #include <memory>
+#include <unordered_map>
 #include <vector>
 #include <cmath>
 #include <EntityManager.h>
+#include "VisibilityPolygon.h"
+#include "ObstacleGrid.h"
+#include "LightingQualityController.h"
+#include "RenderCommandList.h"
 
 class PlayerEntity;
 class Entity;
 
 /**
  * DarkLevelSystem - Handles darkness effects and lighting with shadow casting
+ *
+ * Shadow casters follow the level's solid entities (ground and obstacles):
+ * they are registered as the EntityManager adds them, dropped when it removes
+ * them, and moved when their bodies move, so no periodic rebuild is needed.
  */
-class DarkLevelSystem {
+class DarkLevelSystem : public EntityManager::Listener {
 public:
     DarkLevelSystem();
-    ~DarkLevelSystem();
+    ~DarkLevelSystem() override;
 
     void initialize(sf::RenderWindow& window);
     void update(float dt, PlayerEntity* player);
-    void render(sf::RenderWindow& window);
+    // Records the darkness and the lightmap pass for the given world view
+    void render(RenderCommandList& commands, const sf::View& view);
 
     // Darkness control
     void setDarknessLevel(float level); // 0.0 = bright, 1.0 = complete darkness
@@ -28,17 +38,30 @@ public:
     void addLightSource(const sf::Vector2f& position, float radius, sf::Color color = sf::Color::White);
     void clearLightSources();
 
-    // Shadow casting
-    void registerObstacle(const sf::FloatRect& bounds);
+    // Follow the solid entities of this manager as shadow casters
+    void attach(EntityManager& entityManager);
+    // Stop following the manager and drop the casters taken from it
+    void detach();
+
+    // EntityManager::Listener
+    void onEntityAdded(Entity* entity) override;
+    void onEntityRemoved(Entity* entity) override;
+
+    // Shadow casting; changing an obstacle only rebuilds the lights it touches
+    ObstacleGrid::Id registerObstacle(const sf::FloatRect& bounds);
+    void moveObstacle(ObstacleGrid::Id id, const sf::FloatRect& bounds);
+    void removeObstacle(ObstacleGrid::Id id);
     void clearObstacles();
     void setObstacles(const std::vector<sf::FloatRect>& obstacles);
 
-    void drawRedEyes(sf::RenderWindow& window, EntityManager& entityManager);
-
     // Enable/disable the system
     void setEnabled(bool enabled) { m_enabled = enabled; }
     bool isEnabled() const { return m_enabled; }
 
+    // Ambient light sources (torches, blue glow) are not drawn unless enabled
+    void setAmbientLightsVisible(bool visible) { m_ambientLightsVisible = visible; }
+    bool areAmbientLightsVisible() const { return m_ambientLightsVisible; }
+
     void updateFlashlightDirection(const sf::Vector2f& playerPos, const sf::Vector2f& mousePos);
 
     // Flashlight settings
@@ -48,15 +71,20 @@ public:
 
     void updatePlayerLight(PlayerEntity* player);
 
-private:
-    // Light source structure
-    struct LightSource {
-        sf::Vector2f position;
-        float radius;
-        sf::Color color;
-        float intensity;
-    };
+    // Lightmap resolution divisor: 1 = full, 2 = half, 4 = quarter resolution
+    void setLightmapScale(unsigned int divisor);
+    unsigned int getLightmapScale() const { return m_lightmapScale; }
+
+    // Adaptive quality: lighting time per frame is kept inside the budget
+    void setLightingBudget(float milliseconds) { m_quality.setBudget(milliseconds); }
+    std::size_t getQualityLevel() const { return m_quality.getLevel(); }
+    float getLightingTime() const { return m_quality.getLastLightingTime(); }
+    float getAverageLightingTime() const { return m_quality.getAverageLightingTime(); }
+
+    // Number of static light meshes rebuilt by the last render()
+    std::size_t getLightRebuildCount() const { return m_lightRebuilds; }
 
+private:
     // Ray structure for shadow casting
     struct Ray {
         sf::Vector2f origin;
@@ -65,49 +93,65 @@ private:
         sf::Vector2f endPoint;
     };
 
-    // Obstacle structure
-    struct Obstacle {
-        sf::FloatRect bounds;
-        sf::ConvexShape shape;
+    // Scratch buffers for one shadow-casting job, kept between frames
+    struct ShadowWorkspace {
+        VisibilityPolygon visibility;
+        std::vector<ObstacleGrid::Id> nearby;
+        std::vector<Ray> rays;
     };
 
-    // Intersection point data
-    struct Intersection {
-        sf::Vector2f point;
-        float distance;
-        bool valid;
+    // Light source structure; lights never move, so their mesh is cached
+    struct LightSource {
+        sf::Vector2f position;
+        float radius;
+        sf::Color color;
+        float intensity;
+        sf::VertexArray mesh{ sf::TriangleFan };
+        sf::CircleShape halo;
+        bool dirty = true;                            // Mesh must be rebuilt before drawing
+        ShadowWorkspace workspace;                    // Owned by this light's mesh job
     };
 
-    // Shadow map rendering
-    void renderShadowMap(const sf::Vector2f& lightPos, float radius, sf::RenderTexture& target);
-    void castRays(const sf::Vector2f& origin, std::vector<Ray>& rays, float maxDistance);
+    // Entity-driven obstacles
+    void syncEntityObstacles();
+    static bool castsShadow(Entity* entity);
+    static bool isMobile(Entity* entity);
+    static sf::FloatRect boundsOf(Entity* entity);
 
-    // Light rendering
-    void renderFlashlight(sf::RenderWindow& window);
-    void drawFlashlightCone(float intensity);
-    void renderLightSources(sf::RenderTexture& target);
+    // Lightmap setup
+    bool createLightmap();
+    void applyQualityLevel();
+
+    // Shadow casting
+    void castRays(const sf::Vector2f& origin, float maxDistance, ShadowWorkspace& workspace) const;
 
-    // Shadow casting helpers
-    Intersection rayObstacleIntersection(const Ray& ray, const Obstacle& obstacle);
-    sf::Vector2f calculateIntersection(const sf::Vector2f& rayStart, const sf::Vector2f& rayEnd,
-                                        const sf::Vector2f& segStart, const sf::Vector2f& segEnd);
+    // Light rendering
+    void buildFlashlightCone(float intensity);
+    void buildLightMeshes();
+    void renderLightSources(RenderCommandList& commands);
+    void rebuildLightMesh(LightSource& light) const;
+    void invalidateLights(const sf::FloatRect& area);
 
     // Main system state
     bool m_enabled = false;
+    bool m_ambientLightsVisible = false;
     float m_darknessLevel = 0.5f;
 
     // Lighting system
     std::vector<LightSource> m_lightSources;
-    std::vector<Obstacle> m_obstacles;
+    ObstacleGrid m_obstacles;                         // Spatial index for shadow casters
+    EntityManager* m_source = nullptr;                // Manager whose entities cast shadows
+    std::unordered_map<Entity*, ObstacleGrid::Id> m_entityObstacles;
+    std::vector<Entity*> m_pendingEntities;           // Added since the last update
+    std::vector<Entity*> m_movingCasters;             // Casters with non-static bodies
     sf::Vector2f m_playerLightPos;
     float m_playerLightRadius = 200.0f;
 
-    // Render targets
-    std::unique_ptr<sf::RenderTexture> m_lightTexture;
-    std::unique_ptr<sf::RenderTexture> m_darknessTexture;
-    std::unique_ptr<sf::RenderTexture> m_shadowMapTexture;
-    std::unique_ptr<sf::RenderTexture> m_flashlightTexture;
-    std::unique_ptr<sf::RenderTexture> m_maskTexture;
+    // Render target: every light is accumulated here and upsampled onto the window.
+    // Shared with recorded frames, so a resize never frees one still being drawn
+    std::shared_ptr<sf::RenderTexture> m_lightmap;
+    unsigned int m_lightmapScale = 2;
+    sf::Vector2u m_windowSize;
 
     // Darkness overlay
     sf::RectangleShape m_darknessOverlay;
@@ -128,7 +172,15 @@ private:
     sf::Shader m_shadowShader;
     bool m_useShaders = false;
 
+    // Shadow casting
+    std::vector<LightSource*> m_pendingLights;        // Lights rebuilt this frame
+    sf::VertexArray m_flashlightCone{ sf::TriangleFan };
+    std::size_t m_lightRebuilds = 0;
+
     // Shadow quality settings
-    int m_rayCount = 360;                             // Number of rays for shadow casting
     float m_rayStep = 1.0f;                           // Angle step for ray casting
+    int m_coneSegments = 30;                          // Rays in the shadowed flashlight cone
+    std::size_t m_arcSegments = 64;                   // Edges of each light's reach
+    LightingQualityController m_quality;
+    sf::Clock m_lightingClock;
 };
\ No newline at end of file
@@ -0,0 +1,58 @@
+#pragma once
+#include <cstddef>
+#include <vector>
+
+/**
+ * @class LightingQualityController
+ * @brief Picks a lighting quality level that keeps lighting inside a time budget.
+ *
+ * The owner reports how long lighting took each frame. The controller keeps a
+ * smoothed average and steps the quality down when the average stays above
+ * the budget, and back up only after it has stayed well below it for a while.
+ * The gap between the two thresholds plus a cooldown after every change
+ * stops the level from flickering between two settings.
+ */
+class LightingQualityController {
+public:
+    /**
+     * @brief Settings applied at one quality level.
+     */
+    struct Level {
+        int rayCount;                ///< Rays in the flashlight cone.
+        std::size_t arcSegments;     ///< Edges approximating each light's reach.
+        unsigned int lightmapScale;  ///< Lightmap resolution divisor, at least 2 at every level.
+    };
+
+    explicit LightingQualityController(float budgetMs = 2.0f);
+
+    /**
+     * @brief Feeds one frame's lighting time.
+     * @return True if the quality level changed.
+     */
+    bool update(float lightingMs);
+
+    void setBudget(float budgetMs) { m_budgetMs = budgetMs; }
+    float getBudget() const { return m_budgetMs; }
+
+    void setLevel(std::size_t level);
+    std::size_t getLevel() const { return m_level; }
+    std::size_t getLevelCount() const { return m_levels.size(); }
+    const Level& getSettings() const { return m_levels[m_level]; }
+
+    float getLastLightingTime() const { return m_lastMs; }
+    float getAverageLightingTime() const { return m_averageMs; }
+    // Number of automatic level changes made by update()
+    std::size_t getLevelChangeCount() const { return m_levelChanges; }
+
+private:
+    std::vector<Level> m_levels;     // Cheapest first
+    std::size_t m_level;
+    float m_budgetMs;
+
+    float m_lastMs = 0.0f;
+    float m_averageMs = 0.0f;
+    int m_framesOver = 0;
+    int m_framesUnder = 0;
+    int m_cooldown = 0;
+    std::size_t m_levelChanges = 0;
+};
@@ -0,0 +1,85 @@
+#pragma once
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/System/Vector2.hpp>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @class ObstacleGrid
+ * @brief Uniform grid of rectangular light obstacles.
+ *
+ * Obstacles are registered in every cell they overlap. Radius queries only
+ * visit the cells under the light, and rays walk the grid cell by cell (DDA)
+ * with a slab test per obstacle, stopping at the first cell that contains a
+ * hit. Light cost therefore follows the obstacle density around the light,
+ * not the number of obstacles in the level.
+ *
+ * All queries are const and keep no internal scratch state, so several
+ * threads may query the grid at once while it is not being modified.
+ */
+class ObstacleGrid {
+public:
+    using Id = std::uint32_t;
+    static constexpr Id INVALID_ID = 0xFFFFFFFF;
+
+    /**
+     * @brief Result of a successful raycast.
+     */
+    struct RayHit {
+        sf::Vector2f point;     ///< World position of the hit.
+        float distance = 0.f;   ///< Distance along the ray.
+        Id obstacle = INVALID_ID;
+    };
+
+    explicit ObstacleGrid(float cellSize);
+
+    /** @brief Registers an obstacle and returns its id (ids are reused after remove()). */
+    Id add(const sf::FloatRect& bounds);
+    void remove(Id id);
+    void move(Id id, const sf::FloatRect& bounds);
+    void clear();
+
+    bool contains(Id id) const { return id < m_obstacles.size() && m_obstacles[id].alive; }
+    const sf::FloatRect& getBounds(Id id) const { return m_obstacles[id].bounds; }
+    std::size_t size() const { return m_count; }
+
+    /**
+     * @brief Appends the ids of obstacles touching the circle (sorted, no duplicates).
+     */
+    void queryRadius(const sf::Vector2f& center, float radius, std::vector<Id>& out) const;
+
+    /**
+     * @brief Appends the ids of obstacles overlapping the rectangle (sorted, no duplicates).
+     */
+    void queryRect(const sf::FloatRect& area, std::vector<Id>& out) const;
+
+    /**
+     * @brief Finds the nearest obstacle along a ray.
+     * @param direction Unit direction.
+     * @return True if an obstacle is hit within maxDistance. Obstacles containing
+     *         the origin are ignored, matching the visibility polygon.
+     */
+    bool raycast(const sf::Vector2f& origin, const sf::Vector2f& direction, float maxDistance, RayHit& hit) const;
+
+private:
+    struct Slot {
+        sf::FloatRect bounds;
+        bool alive = false;
+    };
+
+    using CellKey = std::int64_t;
+
+    static CellKey makeKey(int cellX, int cellY);
+    int cellCoord(float value) const;
+    void link(Id id);
+    void unlink(Id id);
+    bool intersectRay(const sf::FloatRect& bounds, const sf::Vector2f& origin,
+        const sf::Vector2f& inverseDirection, float maxDistance, float& distance) const;
+
+    float m_cellSize;
+    std::vector<Slot> m_obstacles;
+    std::vector<Id> m_freeIds;
+    std::size_t m_count = 0;
+    std::unordered_map<CellKey, std::vector<Id>> m_cells;
+};
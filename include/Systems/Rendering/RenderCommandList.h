@@ -0,0 +1,119 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+/**
+ * @class RenderCommandList
+ * @brief A frame's draws recorded as plain data so another thread can replay them.
+ *
+ * sf::RenderTarget::draw is not virtual, so recording cannot hide behind a
+ * render target. Instead everything the game draws is flattened while it is
+ * recorded: sprites, shapes and text become triangles in one shared vertex
+ * pool, vertex arrays are copied, and views are stored by value. Replay then
+ * only issues draw calls and never touches game objects.
+ *
+ * Consecutive triangle draws with the same texture, blend mode and transform
+ * are merged into one command. Resources that must outlive the frame that
+ * recorded them (vertex buffers, offscreen targets) are held by shared_ptr.
+ * Textures and fonts are referenced by pointer and must stay alive until the
+ * frame has been presented; ScreenManager waits for the render thread before
+ * destroying a screen for that reason.
+ *
+ * Text glyphs are looked up while recording. They must already be cached by
+ * the font (see RenderThread::prepareGlyphs), otherwise the lookup would
+ * update a page texture the render thread may be drawing with. Underline and
+ * strike-through are not reproduced.
+ */
+class RenderCommandList {
+public:
+    using Callback = std::function<void(sf::RenderTarget&)>;
+
+    /**
+     * @brief Drops all commands while keeping their storage.
+     */
+    void clear();
+
+    void setView(const sf::View& view);
+
+    void draw(const sf::Vertex* vertices, std::size_t count, sf::PrimitiveType type,
+        const sf::RenderStates& states = sf::RenderStates::Default);
+    void draw(const sf::VertexArray& vertices, const sf::RenderStates& states = sf::RenderStates::Default);
+    void draw(const sf::Sprite& sprite, const sf::RenderStates& states = sf::RenderStates::Default);
+    void draw(const sf::Shape& shape, const sf::RenderStates& states = sf::RenderStates::Default);
+    void draw(const sf::Text& text, const sf::RenderStates& states = sf::RenderStates::Default);
+
+    /**
+     * @brief Draws a vertex buffer; the list keeps it alive until replayed.
+     */
+    void draw(std::shared_ptr<sf::VertexBuffer> buffer, const sf::RenderStates& states = sf::RenderStates::Default);
+
+    /**
+     * @brief Fills a vertex buffer on the render thread, resizing it if needed.
+     */
+    void upload(std::shared_ptr<sf::VertexBuffer> buffer, const sf::VertexArray& vertices);
+
+    /**
+     * @brief Redirects following commands to an offscreen target until endOffscreen().
+     */
+    void beginOffscreen(std::shared_ptr<sf::RenderTexture> target, const sf::View& view,
+        const sf::Color& clearColor = sf::Color::Transparent);
+    void endOffscreen();
+
+    /**
+     * @brief Runs arbitrary drawing code at replay time.
+     *
+     * For code that has not been converted to recording. The callback runs on
+     * the render thread, so a list containing one must not be replayed while
+     * the recording thread moves on (see requiresSync()).
+     */
+    void addCallback(Callback callback);
+
+    /**
+     * @brief True if the list holds callbacks that read live game state.
+     */
+    bool requiresSync() const { return !m_callbacks.empty(); }
+
+    /**
+     * @brief Issues every recorded command to the target, in order.
+     */
+    void replay(sf::RenderTarget& target) const;
+
+    std::size_t getCommandCount() const { return m_commands.size(); }
+    std::size_t getVertexCount() const { return m_vertices.getVertexCount(); }
+
+private:
+    enum class Type : std::uint8_t {
+        View,
+        Vertices,
+        Buffer,
+        Upload,
+        BeginOffscreen,
+        EndOffscreen,
+        Callback
+    };
+
+    struct Command {
+        Type type = Type::Vertices;
+        sf::PrimitiveType primitive = sf::Triangles;
+        std::uint32_t first = 0;     ///< First vertex in the pool.
+        std::uint32_t count = 0;     ///< Vertex count.
+        std::uint32_t resource = 0;  ///< Index into the list matching the type.
+        sf::RenderStates states;
+        sf::Color clearColor;
+    };
+
+    /** @brief Starts a triangle run, or extends the last one if its states match. */
+    Command& triangles(const sf::RenderStates& states);
+    void appendTriangles(const sf::Vertex* vertices, std::size_t count, const sf::RenderStates& states);
+    void appendGlyphs(const sf::Text& text, const sf::Transform& transform, bool outline);
+
+    std::vector<Command> m_commands;
+    sf::VertexArray m_vertices{ sf::Triangles };      ///< Geometry of every draw in the frame.
+    std::vector<sf::View> m_views;
+    std::vector<std::shared_ptr<sf::VertexBuffer>> m_buffers;
+    std::vector<std::shared_ptr<sf::RenderTexture>> m_offscreens;
+    std::vector<Callback> m_callbacks;
+};
@@ -0,0 +1,21 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Coarse draw order used by the RenderQueue. Lower layers are drawn first.
+ */
+enum class RenderLayer : std::uint8_t {
+    Background = 0,  ///< Scrolling background images
+    Tiles,           ///< Baked static tiles (ground, sea, cactus)
+    World,           ///< Props such as boxes, flags and wells
+    Items,           ///< Coins and gifts
+    Characters,      ///< Player and enemies
+    Projectiles,     ///< Bullets and other short-lived sprites
+    Lighting,        ///< Darkness overlay of the dark level
+    Effects,         ///< Glows that must stay visible through the darkness (enemy eyes)
+    UI,              ///< Screen-space HUD and messages
+    Count
+};
+
+constexpr std::size_t RENDER_LAYER_COUNT = static_cast<std::size_t>(RenderLayer::Count);
@@ -0,0 +1,88 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+#include "RenderLayer.h"
+#include "RenderCommandList.h"
+
+/**
+ * @class RenderQueue
+ * @brief Per-frame list of draw items ordered by a 64-bit sort key.
+ *
+ * Every item gets a key built from (layer, texture, depth). The queue is radix
+ * sorted once per frame, so items come out in layer order and, inside a layer,
+ * grouped by texture. Consecutive items sharing a texture are merged into a
+ * single draw call. Systems that draw themselves (background, darkness, UI)
+ * submit a pass callback that records at its place in the order.
+ */
+class RenderQueue {
+public:
+    using Pass = std::function<void(RenderCommandList&)>;
+
+    /**
+     * @brief Counters for the last flushed frame.
+     */
+    struct Stats {
+        std::size_t sprites = 0;    ///< Sprites submitted.
+        std::size_t shapes = 0;     ///< Untextured primitives submitted.
+        std::size_t passes = 0;     ///< Pass callbacks executed.
+        std::size_t drawCalls = 0;  ///< Geometry draws issued (passes not included).
+    };
+
+    /**
+     * @brief Clears queued items while keeping their storage.
+     */
+    void begin();
+
+    /**
+     * @brief Sets the view applied whenever drawing enters the given layer.
+     */
+    void setLayerView(RenderLayer layer, const sf::View& view);
+
+    void submit(const sf::Sprite& sprite, RenderLayer layer, std::uint16_t depth = 0);
+
+    void submitCircle(const sf::Vector2f& center, float radius, const sf::Color& fillColor,
+        RenderLayer layer, float outlineThickness = 0.f,
+        const sf::Color& outlineColor = sf::Color::Transparent, std::uint16_t depth = 0);
+
+    /**
+     * @brief Queues a callback that records its own draws.
+     * @param depth Order among passes and untextured items of the same layer.
+     */
+    void submitPass(RenderLayer layer, std::uint16_t depth, Pass pass);
+
+    /**
+     * @brief Sorts everything queued since begin() and records it in order.
+     */
+    void flush(RenderCommandList& commands);
+
+    const Stats& getStats() const { return m_stats; }
+    std::size_t size() const { return m_items.size(); }
+
+private:
+    struct Item {
+        std::uint64_t key = 0;
+        const sf::Texture* texture = nullptr;
+        std::uint32_t firstVertex = 0;
+        std::uint32_t vertexCount = 0;
+        std::int32_t pass = -1;  ///< Index into m_passes, or -1 for geometry.
+        RenderLayer layer = RenderLayer::World;
+    };
+
+    std::uint64_t makeKey(RenderLayer layer, const sf::Texture* texture, std::uint16_t depth);
+    void sortItems();
+
+    std::vector<Item> m_items;
+    std::vector<Pass> m_passes;
+    std::vector<std::uint32_t> m_order;     ///< Item indices in sorted order.
+    std::vector<std::uint32_t> m_scratch;   ///< Radix sort ping-pong buffer.
+    sf::VertexArray m_vertices{ sf::Triangles };  ///< Geometry of all items in submission order.
+    std::unordered_map<const sf::Texture*, std::uint32_t> m_textureIds;
+    std::array<std::optional<sf::View>, RENDER_LAYER_COUNT> m_layerViews;
+    Stats m_pending;
+    Stats m_stats;
+};
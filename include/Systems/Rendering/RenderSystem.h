@@ -1,8 +1,62 @@
 #pragma once
 #include "EntityManager.h"
+#include "RenderQueue.h"
+#include "SpatialGrid.h"
+#include "StaticTileLayer.h"
 #include <SFML/Graphics.hpp>
+#include <vector>
 
-class RenderSystem {
+/**
+ * RenderSystem - Submits the active entities that overlap the current view to the
+ * frame's RenderQueue, using each RenderComponent's layer and depth.
+ *
+ * Renderable entities are kept in a SpatialGrid maintained from EntityManager
+ * lifecycle notifications. Entities with a moving physics body are tracked in a
+ * separate short list and tested every frame; everything else is only touched
+ * when its grid cell overlaps the view. Sprites flagged static are baked into a
+ * StaticTileLayer and drawn per chunk as a pass in the Tiles layer.
+ */
+class RenderSystem : public EntityManager::Listener {
 public:
-    void render(EntityManager& entityManager, sf::RenderWindow& window);
-};
\ No newline at end of file
+    RenderSystem();
+    ~RenderSystem() override;
+
+    void render(EntityManager& entityManager, RenderQueue& queue, const sf::View& view);
+
+    // EntityManager::Listener
+    void onEntityAdded(Entity* entity) override;
+    void onEntityRemoved(Entity* entity) override;
+
+    // Non-static entities drawn in the last frame, ordered by id
+    const std::vector<Entity*>& getVisibleEntities() const { return m_visible; }
+    std::size_t getVisibleCount() const { return m_visible.size() + m_tileLayer.getVisibleTileCount(); }
+    std::size_t getTotalCount() const { return m_grid.size() + m_mobile.size() + m_tileLayer.getTileCount(); }
+
+    // Extra world-space border around the view that still counts as visible
+    void setCullMargin(float margin) { m_cullMargin = margin; }
+
+    // Print statistics to the console every N frames (0 = never)
+    void setStatsInterval(int frames) { m_statsInterval = frames; }
+
+private:
+    void attach(EntityManager& entityManager);
+    void indexPendingEntities();
+    void collectVisible(const sf::FloatRect& area);
+    void reportStats(const RenderQueue& queue) const;
+
+    static bool isRenderable(Entity* entity);
+    static bool isMobile(Entity* entity);
+    static sf::FloatRect boundsOf(Entity* entity);
+
+    EntityManager* m_source = nullptr;  ///< Manager whose lifecycle notifications keep the index current.
+    SpatialGrid m_grid;                 ///< Entities that only move when something else moves them.
+    StaticTileLayer m_tileLayer;        ///< Baked chunks of static tiles.
+    std::vector<Entity*> m_mobile;      ///< Entities with non-static physics bodies.
+    std::vector<Entity*> m_pending;     ///< Added since the last frame, indexed on next render.
+    std::vector<Entity*> m_candidates;  ///< Scratch buffer for grid queries.
+    std::vector<Entity*> m_visible;
+    float m_cullMargin;
+    std::size_t m_tileDrawCalls = 0;
+    int m_frameCount = 0;
+    int m_statsInterval = 300;
+};
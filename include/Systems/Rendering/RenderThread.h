@@ -0,0 +1,135 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <thread>
+#include "RenderCommandList.h"
+
+/**
+ * @class RenderThread
+ * @brief Owns the window's GL context and replays recorded frames on its own thread.
+ *
+ * Three command lists rotate between the roles write (being recorded by the
+ * update thread), ready (submitted, waiting) and render (being replayed).
+ * submitFrame() swaps write and ready, so the update thread can record frame
+ * N+1 while frame N is still being drawn. If the update thread gets a whole
+ * frame ahead it waits for the ready slot to be picked up, which keeps input
+ * latency at most one frame above the single-threaded loop.
+ *
+ * The render thread paces itself to the framerate limit; the window's own
+ * limiter would sleep while holding the window. Code that must talk to the
+ * window directly (event polling) takes a WindowLock; modal screens that run
+ * their own loop take an ExclusiveAccess, which hands the context back to the
+ * calling thread until it goes out of scope.
+ */
+class RenderThread {
+public:
+    RenderThread(sf::RenderWindow& window, unsigned int framerateLimit);
+    ~RenderThread();
+    RenderThread(const RenderThread&) = delete;
+    RenderThread& operator=(const RenderThread&) = delete;
+
+    /**
+     * @brief The render thread currently driving the window, or nullptr.
+     */
+    static RenderThread* current();
+
+    /**
+     * @brief Rasterizes the printable ASCII glyphs of one font size up front.
+     *
+     * Recording an sf::Text looks its glyphs up on the recording thread; a
+     * glyph that is not cached yet would be added to the font's page texture
+     * while the render thread may be drawing with it. Text that is recorded
+     * must therefore have its glyphs prepared when it is set up. Waits for
+     * the render thread to go idle before touching the font.
+     */
+    static void prepareGlyphs(const sf::Font& font, unsigned int characterSize, float outlineThickness = 0.f);
+    static void prepareGlyphs(const sf::Text& text);
+
+    /**
+     * @brief Returns the cleared list to record the next frame into.
+     */
+    RenderCommandList& beginFrame();
+
+    /**
+     * @brief Publishes the list from beginFrame() to the render thread.
+     *
+     * Lists with callbacks are waited on until presented, because the
+     * callbacks read state the caller is about to change.
+     */
+    void submitFrame();
+
+    /**
+     * @brief Blocks until every submitted frame has been presented.
+     *
+     * A WindowLock held by the caller is released while waiting.
+     */
+    void waitIdle();
+
+    /**
+     * @brief Keeps the render thread off the window; used around event polling.
+     *
+     * Accepts nullptr so callers need not check whether a thread is running.
+     */
+    class WindowLock {
+    public:
+        explicit WindowLock(RenderThread* thread);
+        ~WindowLock();
+        WindowLock(const WindowLock&) = delete;
+        WindowLock& operator=(const WindowLock&) = delete;
+
+    private:
+        RenderThread* m_thread;
+    };
+
+    /**
+     * @brief Gives the calling thread direct use of the window for its lifetime.
+     *
+     * The render thread finishes pending frames, releases the GL context and
+     * waits. Does nothing when no render thread is running. Nests.
+     */
+    class ExclusiveAccess {
+    public:
+        ExclusiveAccess();
+        ~ExclusiveAccess();
+        ExclusiveAccess(const ExclusiveAccess&) = delete;
+        ExclusiveAccess& operator=(const ExclusiveAccess&) = delete;
+
+    private:
+        RenderThread* m_thread;
+    };
+
+    std::size_t getFramesPresented() const { return m_presented; }
+    float getAverageReplayTime() const { return m_averageReplayMs; }
+
+private:
+    void run();
+    void present(const RenderCommandList& commands);
+    void pause();
+    void resume();
+
+    sf::RenderWindow& m_window;
+    unsigned int m_framerateLimit;
+    std::array<RenderCommandList, 3> m_lists;
+    std::size_t m_writeIndex = 0;
+    std::size_t m_readyIndex = 1;
+    std::size_t m_renderIndex = 2;
+    bool m_hasReady = false;
+
+    std::mutex m_mutex;
+    std::condition_variable m_changed;
+    std::mutex m_windowMutex;
+    std::atomic<std::thread::id> m_windowOwner;      // Thread holding a WindowLock
+    std::thread m_thread;
+
+    std::size_t m_submitted = 0;
+    std::atomic<std::size_t> m_presented{ 0 };
+    std::atomic<float> m_averageReplayMs{ 0.0f };
+    int m_pauseDepth = 0;
+    bool m_pauseRequested = false;
+    bool m_paused = false;
+    bool m_stopping = false;
+};
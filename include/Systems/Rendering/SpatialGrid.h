@@ -0,0 +1,75 @@
+#pragma once
+#include <SFML/Graphics/Rect.hpp>
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+class Entity;
+
+/**
+ * @class SpatialGrid
+ * @brief Uniform hash grid that buckets entities by the center of their bounds.
+ *
+ * Used for culling: a query only visits the cells overlapping the requested
+ * area, so entities far from the camera are never touched. Query areas are
+ * grown by the largest half-extent inserted so far, which keeps sprites wider
+ * than a cell from being missed. Cells are dropped as soon as they are empty.
+ */
+class SpatialGrid {
+public:
+    using BoundsFunction = std::function<sf::FloatRect(Entity*)>;
+
+    explicit SpatialGrid(float cellSize);
+
+    /** @brief Adds an entity, or moves it if it is already indexed. */
+    void insert(Entity* entity, const sf::FloatRect& bounds);
+
+    /**
+     * @brief Re-buckets an indexed entity after it moved.
+     * @return True if the entity changed cell.
+     */
+    bool update(Entity* entity, const sf::FloatRect& bounds);
+
+    void remove(Entity* entity);
+    void clear();
+
+    /**
+     * @brief Re-buckets the next few indexed entities in a round-robin sweep.
+     *
+     * Entities moved away from the queried area are not seen by query(), so
+     * callers refresh a slice of the index every frame to catch them.
+     * @return Number of entities that changed cell.
+     */
+    std::size_t refresh(std::size_t count, const BoundsFunction& boundsOf);
+
+    /**
+     * @brief Appends every entity whose cell may overlap the area (caller filters exactly).
+     */
+    void query(const sf::FloatRect& area, std::vector<Entity*>& out) const;
+
+    bool contains(const Entity* entity) const { return m_slotOf.count(entity) > 0; }
+    std::size_t size() const { return m_entries.size(); }
+    std::size_t getCellCount() const { return m_cells.size(); }
+
+private:
+    using CellKey = std::int64_t;
+
+    struct Entry {
+        Entity* entity = nullptr;
+        CellKey cell = 0;
+    };
+
+    CellKey keyFor(const sf::FloatRect& bounds) const;
+    static CellKey makeKey(int cellX, int cellY);
+    bool moveToCell(Entry& entry, const sf::FloatRect& bounds);
+    void removeFromCell(Entity* entity, CellKey key);
+
+    float m_cellSize;
+    float m_maxHalfWidth = 0.f;
+    float m_maxHalfHeight = 0.f;
+    std::unordered_map<CellKey, std::vector<Entity*>> m_cells;
+    std::vector<Entry> m_entries;                              // Dense, so refresh() can sweep it
+    std::unordered_map<const Entity*, std::size_t> m_slotOf;   // Entity -> index in m_entries
+    std::size_t m_sweep = 0;
+};
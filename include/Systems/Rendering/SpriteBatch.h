@@ -0,0 +1,36 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+
+/**
+ * @class SpriteBatch
+ * @brief Converts sprites and circles into triangles for batched vertex arrays.
+ *
+ * RenderQueue, RenderCommandList and StaticTileLayer gather geometry that
+ * shares a texture into one triangle list and draw it in a single call;
+ * these helpers produce the triangles they append.
+ */
+class SpriteBatch {
+public:
+    SpriteBatch() = delete;
+
+    /**
+     * @brief Appends the two triangles of a sprite to a triangle list (texture is not checked).
+     * @param vertices Target triangle list.
+     * @param sprite Sprite providing transform, texture rect and color.
+     */
+    static void appendSprite(sf::VertexArray& vertices, const sf::Sprite& sprite);
+
+    /**
+     * @brief Appends a filled circle (and optional outline ring) to a triangle list.
+     * @param center Circle center in world coordinates.
+     * @param radius Fill radius.
+     * @param fillColor Fill color.
+     * @param outlineThickness Width of the outline ring drawn outside the radius (0 = none).
+     * @param outlineColor Outline color.
+     * @param pointCount Number of segments used to approximate the circle.
+     */
+    static void appendCircle(sf::VertexArray& vertices, const sf::Vector2f& center, float radius,
+        const sf::Color& fillColor, float outlineThickness = 0.f,
+        const sf::Color& outlineColor = sf::Color::Transparent, std::size_t pointCount = 16);
+};
@@ -0,0 +1,68 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <map>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+#include "RenderCommandList.h"
+
+class Entity;
+
+/**
+ * @class StaticTileLayer
+ * @brief Bakes entities that never move (ground, edges, sea, cactus) into column chunks.
+ *
+ * Each chunk covers a fixed width of the level and stores one static vertex
+ * buffer per texture. A chunk is rebuilt only when a tile inside it is added or
+ * removed, and drawing touches only the chunks that overlap the view, so the
+ * per-frame cost stays at a few draws regardless of level length.
+ *
+ * Buffers are filled by an upload command in the first frame that draws a
+ * rebaked chunk, so the GPU work happens on the render thread. The buffers are
+ * shared with the command list, which keeps a replaced one alive until the
+ * frames still using it have been drawn.
+ */
+class StaticTileLayer {
+public:
+    explicit StaticTileLayer(float chunkWidth);
+
+    /** @brief Adds a tile; its sprite must already be positioned. */
+    void add(Entity* entity);
+    void remove(Entity* entity);
+    void clear();
+
+    /**
+     * @brief Records the chunks overlapping the area, rebaking dirty ones first.
+     * @return Number of draw calls recorded.
+     */
+    std::size_t draw(RenderCommandList& commands, const sf::FloatRect& area);
+
+    std::size_t getTileCount() const { return m_chunkOf.size(); }
+    std::size_t getChunkCount() const { return m_chunks.size(); }
+    std::size_t getVisibleChunkCount() const { return m_visibleChunks; }
+    std::size_t getVisibleTileCount() const { return m_visibleTiles; }
+
+private:
+    struct Part {
+        const sf::Texture* texture = nullptr;
+        sf::VertexArray vertices{ sf::Triangles };
+        std::shared_ptr<sf::VertexBuffer> buffer;  ///< Null when vertex buffers are unsupported.
+        bool needsUpload = false;  ///< True until the vertices have been sent to the buffer.
+    };
+
+    struct Chunk {
+        std::vector<Entity*> tiles;
+        std::vector<Part> parts;
+        sf::FloatRect bounds;
+        bool dirty = true;
+    };
+
+    int columnOf(const Entity* entity) const;
+    void bake(Chunk& chunk);
+
+    float m_chunkWidth;
+    std::map<int, Chunk> m_chunks;                    ///< Ordered by column so views map to a key range.
+    std::unordered_map<const Entity*, int> m_chunkOf;
+    std::size_t m_visibleChunks = 0;
+    std::size_t m_visibleTiles = 0;
+};
@@ -0,0 +1,82 @@
+#pragma once
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/System/Vector2.hpp>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @class VisibilityPolygon
+ * @brief Computes the area lit by a point light among rectangular obstacles.
+ *
+ * Instead of sampling a fixed number of rays, the polygon is built with an
+ * angular sweep: only the edges that face the light are kept, their endpoints
+ * become sweep events sorted by angle, and one ray is resolved just before and
+ * just after every event against the edges currently under the sweep line.
+ * The light's reach is a circle approximated by arcSegments edges, so open
+ * directions end on the circle exactly like the old fixed-count rays did.
+ *
+ * Usage: begin(), addObstacle() for each nearby rectangle, then build().
+ * All buffers are reused between calls.
+ */
+class VisibilityPolygon {
+public:
+    /**
+     * @brief One polygon corner, in increasing angle order around the light.
+     */
+    struct Vertex {
+        sf::Vector2f point;   ///< World position.
+        float distance = 0.f; ///< Distance from the light.
+    };
+
+    explicit VisibilityPolygon(std::size_t arcSegments = 64);
+
+    void begin(const sf::Vector2f& origin, float radius);
+
+    /**
+     * @brief Adds a rectangle; rectangles outside the light or containing it are ignored.
+     */
+    void addObstacle(const sf::FloatRect& bounds);
+
+    /**
+     * @brief Runs the sweep and returns the polygon (valid until the next begin()).
+     */
+    const std::vector<Vertex>& build();
+
+    /** @brief Changes the number of edges approximating the light's reach (at least 8). */
+    void setArcSegments(std::size_t arcSegments);
+
+    const std::vector<Vertex>& getVertices() const { return m_vertices; }
+    std::size_t getSegmentCount() const { return m_segments.size(); }
+
+private:
+    struct Segment {
+        sf::Vector2f a;
+        sf::Vector2f b;
+    };
+
+    struct Event {
+        float angle;
+        std::uint32_t segment;
+        bool begins;
+    };
+
+    struct Hit {
+        float distance;
+        std::uint32_t segment;
+    };
+
+    void addSegment(const sf::Vector2f& a, const sf::Vector2f& b);
+    float angleOf(const sf::Vector2f& point) const;
+    Hit nearestHit(float angle) const;
+    void emitCrossing(float fromAngle, std::uint32_t fromSegment, float toAngle, std::uint32_t toSegment);
+    void emit(float angle, float distance);
+
+    std::size_t m_arcSegments;
+    sf::Vector2f m_origin;
+    float m_radius = 0.f;
+
+    std::vector<Segment> m_segments;
+    std::vector<Event> m_events;
+    std::vector<std::uint32_t> m_active;  ///< Segments crossed by the sweep ray.
+    std::vector<Vertex> m_vertices;
+};
@@ -0,0 +1,53 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <array>
+#include <string>
+#include "RenderCommandList.h"
+
+/**
+ * @brief HudCounter - A fixed label followed by an integer, for score/lives/timer.
+ *
+ * The label is an sf::Text laid out once. The number is drawn from a glyph
+ * strip: the quads for '0'-'9' and '-' are looked up in the font when the
+ * counter is created, and setValue() only rewrites the vertices when the
+ * value actually changes. An unchanged HUD therefore allocates nothing and
+ * does no text layout per frame.
+ */
+class HudCounter {
+public:
+    HudCounter(const sf::Font& font, unsigned int characterSize, const std::string& label);
+
+    void setPosition(const sf::Vector2f& position);
+    void setFillColor(const sf::Color& color);
+
+    /**
+     * @brief Shows a new value.
+     * @return True if the digits had to be rebuilt.
+     */
+    bool setValue(int value);
+    int getValue() const { return m_value; }
+
+    void draw(RenderCommandList& commands) const;
+
+private:
+    struct Glyph {
+        sf::FloatRect bounds;
+        sf::FloatRect texture;
+        float advance = 0.f;
+    };
+
+    static constexpr std::size_t MAX_CHARS = 11;     // "-2147483648"
+
+    void rebuildDigits();
+
+    const sf::Font& m_font;
+    unsigned int m_characterSize;
+    sf::Text m_label;
+    std::array<Glyph, 11> m_strip;                   // '0'-'9', then '-'
+    std::array<sf::Vertex, MAX_CHARS * 6> m_vertices;
+    std::size_t m_vertexCount = 0;
+    sf::Transform m_digitsTransform;
+    sf::Color m_color = sf::Color::White;
+    int m_value = 0;
+    bool m_hasValue = false;
+};
@@ -2,8 +2,10 @@
 #include "EventSystem.h"
 #include "GameEvents.h"
 #include <SFML/Graphics.hpp>
+#include "RenderCommandList.h"
 #include <string>
 #include <queue>
+#include <vector>
 
 /**
  * UIObserver - Listens to game events and displays notifications
@@ -15,7 +17,7 @@ public:
 
     void initialize();
     void update(float dt);
-    void render(sf::RenderWindow& window);
+    void render(RenderCommandList& commands, const sf::Vector2u& windowSize);
 
 private:
     struct Notification {
@@ -37,4 +39,6 @@ private:
 
     // Animation
     float m_animationTimer = 0.0f;
+
+    std::vector<EventSubscription> m_subscriptions;
 };
\ No newline at end of file
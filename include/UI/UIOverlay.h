@@ -1,22 +1,29 @@
 ﻿#pragma once
 
 #include <SFML/Graphics.hpp>
+#include <memory>
+#include "HudCounter.h"
+#include "RenderCommandList.h"
 
+/**
+ * UIOverlay - Score, lives and timer HUD. Each counter only rebuilds its
+ * geometry when the displayed value changes.
+ */
 class UIOverlay {
 public:
     UIOverlay(float windowWidth);
 
     void handleEvent(const sf::Event& event, const sf::RenderWindow& window);
     void update(int score, int lives);
-    void draw(sf::RenderWindow& window);
+    void draw(RenderCommandList& commands, const sf::View& screenView);
     void reset();
 
 
 private:
     sf::Font m_font;
-    sf::Text m_scoreText;
-    sf::Text m_livesText;
-    sf::Text m_timerText;
+    std::unique_ptr<HudCounter> m_scoreCounter;
+    std::unique_ptr<HudCounter> m_livesCounter;
+    std::unique_ptr<HudCounter> m_timerCounter;
 
     sf::Clock m_timer;
 };
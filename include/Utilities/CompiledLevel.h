@@ -0,0 +1,78 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "MappedFile.h"
+
+/**
+ * @class CompiledLevel
+ * @brief Binary form of a text level (.lvlb), read straight from a memory-mapped file.
+ *
+ * Layout (little-endian):
+ *   Header (32 bytes): "LVLB" | u16 version | u16 flags | u32 width | u32 height |
+ *                      u32 spawn count | u32 grid offset | u32 grid bytes | u32 reserved
+ *   Tile grid:         the character grid padded to width, row by row, packed
+ *                      into runs: a control byte c < 128 is followed by c + 1
+ *                      literal tiles; c >= 128 is followed by one tile repeated
+ *                      c - 125 times (3 to 130)
+ *
+ * Rows are numbered as in the text file (row 0 is the first line). There is
+ * no separate spawn table: the spawns are the spawn characters of the grid,
+ * visited row by row, so they come out in the order the text loader creates
+ * them. Packing keeps a file no larger than its text source plus one byte
+ * per 128 tiles, and long empty or ground stretches shrink to two bytes.
+ */
+class CompiledLevel {
+public:
+    static constexpr char MAGIC[4] = { 'L', 'V', 'L', 'B' };
+    static constexpr std::uint16_t VERSION = 2;
+    static constexpr std::size_t HEADER_SIZE = 32;
+    static constexpr char EMPTY_TILE = '-';
+
+    struct Spawn {
+        char type;
+        std::uint16_t row;
+        std::uint32_t column;
+    };
+
+    /**
+     * @brief Builds the binary image of a level from the lines of its text file.
+     *        A trailing '\r' (CRLF files) is not part of a line. Returns an empty
+     *        image for levels with more than 65535 rows.
+     */
+    static std::vector<std::uint8_t> compile(const std::vector<std::string>& lines);
+
+    /**
+     * @brief Characters that place an entity; everything else is empty space.
+     */
+    static bool isSpawnChar(char c);
+
+    /**
+     * @brief Maps a .lvlb file and checks its header. Returns false if it is not a valid level.
+     */
+    bool open(const std::string& path);
+    void close() { m_file.close(); }
+
+    std::uint32_t getWidth() const { return m_width; }
+    std::uint32_t getHeight() const { return m_height; }
+    std::size_t getSpawnCount() const { return m_spawnCount; }
+
+    /**
+     * @brief Appends every spawn to out, row by row and left to right.
+     */
+    void decodeSpawns(std::vector<Spawn>& out) const;
+
+    /**
+     * @brief Expands the run-length encoded grid back into rows of characters.
+     */
+    std::vector<std::string> decodeGrid() const;
+
+private:
+    MappedFile m_file;
+    std::uint32_t m_width = 0;
+    std::uint32_t m_height = 0;
+    std::size_t m_spawnCount = 0;
+    const std::uint8_t* m_grid = nullptr;
+    std::size_t m_gridBytes = 0;
+};
\ No newline at end of file
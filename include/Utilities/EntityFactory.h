@@ -1,4 +1,5 @@
 #pragma once
+#include <array>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -9,6 +10,10 @@
 /**
  * EntityFactory - Creates entities based on type strings
  * Replaces hardcoded object creation in LevelLoader
+ *
+ * Level tiles are keyed by a single character and live in a 256-entry table
+ * indexed by that character, so spawning a tile needs no string or hash.
+ * Longer names ("Player") stay in the map.
  */
 class EntityFactory {
 public:
@@ -19,16 +24,23 @@ public:
 
     // Register entity creators
     void registerCreator(const std::string& typeName, CreatorFunc creator);
+    void registerCreator(char tileChar, CreatorFunc creator);
 
     // Create entity by type name
     std::unique_ptr<Entity> create(const std::string& typeName, float x, float y);
+    std::unique_ptr<Entity> create(char tileChar, float x, float y);
 
     // Create and add to EntityManager
     Entity* createInManager(const std::string& typeName, float x, float y, EntityManager& manager);
 
+    // Look up a creator once to call it many times; nullptr if none is registered
+    const CreatorFunc* findCreator(const std::string& typeName) const;
+    const CreatorFunc* findCreator(char tileChar) const;
+
     // Check if creator exists
     bool hasCreator(const std::string& typeName) const;
 
 private:
     std::unordered_map<std::string, CreatorFunc> m_creators;
+    std::array<CreatorFunc, 256> m_tileCreators;
 };
\ No newline at end of file
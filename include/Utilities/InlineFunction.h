@@ -0,0 +1,88 @@
+#pragma once
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+template<typename Signature, std::size_t Capacity = 48>
+class InlineFunction;
+
+/**
+ * @class InlineFunction
+ * @brief Move-only callable stored inside the object, never on the heap.
+ *
+ * A replacement for std::function where the callable is known to be small
+ * (typically a lambda capturing `this` and a value or two). Callables that do
+ * not fit in Capacity bytes are rejected at compile time instead of silently
+ * allocating. Calling costs one indirect call through a function pointer.
+ */
+template<typename R, typename... Args, std::size_t Capacity>
+class InlineFunction<R(Args...), Capacity> {
+public:
+    InlineFunction() = default;
+
+    template<typename F, typename = std::enable_if_t<!std::is_same_v<std::decay_t<F>, InlineFunction>>>
+    InlineFunction(F&& callable) {
+        using Stored = std::decay_t<F>;
+        static_assert(sizeof(Stored) <= Capacity, "Callable too large for InlineFunction; capture less or raise Capacity");
+        static_assert(alignof(Stored) <= alignof(std::max_align_t), "Callable is over-aligned for InlineFunction");
+        static_assert(std::is_nothrow_move_constructible_v<Stored>, "Callable must be nothrow movable");
+
+        ::new (static_cast<void*>(m_storage)) Stored(std::forward<F>(callable));
+        m_invoke = [](void* storage, Args... args) -> R {
+            return (*static_cast<Stored*>(storage))(std::forward<Args>(args)...);
+        };
+        m_manage = [](void* destination, void* source) {
+            if (destination) {
+                ::new (destination) Stored(std::move(*static_cast<Stored*>(source)));
+            }
+            static_cast<Stored*>(source)->~Stored();
+        };
+    }
+
+    InlineFunction(InlineFunction&& other) noexcept {
+        moveFrom(other);
+    }
+
+    InlineFunction& operator=(InlineFunction&& other) noexcept {
+        if (this != &other) {
+            reset();
+            moveFrom(other);
+        }
+        return *this;
+    }
+
+    InlineFunction(const InlineFunction&) = delete;
+    InlineFunction& operator=(const InlineFunction&) = delete;
+
+    ~InlineFunction() { reset(); }
+
+    R operator()(Args... args) const {
+        return m_invoke(const_cast<unsigned char*>(m_storage), std::forward<Args>(args)...);
+    }
+
+    explicit operator bool() const { return m_invoke != nullptr; }
+
+    void reset() {
+        if (m_manage) {
+            m_manage(nullptr, m_storage);
+        }
+        m_invoke = nullptr;
+        m_manage = nullptr;
+    }
+
+private:
+    void moveFrom(InlineFunction& other) {
+        if (other.m_manage) {
+            other.m_manage(m_storage, other.m_storage);
+        }
+        m_invoke = other.m_invoke;
+        m_manage = other.m_manage;
+        other.m_invoke = nullptr;
+        other.m_manage = nullptr;
+    }
+
+    alignas(std::max_align_t) unsigned char m_storage[Capacity];
+    R (*m_invoke)(void*, Args...) = nullptr;
+    void (*m_manage)(void* destination, void* source) = nullptr;  ///< Moves into destination (if any), then destroys source.
+};
@@ -0,0 +1,53 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @class JobSystem
+ * @brief Small pool of worker threads for splitting per-frame work.
+ *
+ * parallelFor() hands out indices to the workers and to the calling thread
+ * and returns once every index has been processed, so callers can treat it
+ * like a plain loop. Jobs must only write to data owned by their own index.
+ */
+class JobSystem {
+public:
+    static JobSystem& instance();
+
+    ~JobSystem();
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+    /**
+     * @brief Runs job(i) for every i in [0, count) and waits for all of them.
+     */
+    void parallelFor(std::size_t count, const std::function<void(std::size_t)>& job);
+
+    /** @brief Worker threads plus the calling thread. */
+    std::size_t getThreadCount() const { return m_workers.size() + 1; }
+
+private:
+    JobSystem();
+
+    void workerLoop();
+    std::size_t runIndices(const std::function<void(std::size_t)>& job, std::size_t count);
+
+    std::vector<std::thread> m_workers;
+    std::mutex m_mutex;
+    std::condition_variable m_wake;
+    std::condition_variable m_finished;
+    std::mutex m_submitMutex;                        // One parallelFor at a time
+
+    const std::function<void(std::size_t)>* m_job = nullptr;
+    std::size_t m_count = 0;
+    std::atomic<std::size_t> m_next{ 0 };
+    std::size_t m_remaining = 0;                     // Indices not finished yet
+    std::size_t m_busyWorkers = 0;                   // Workers inside the current job
+    std::size_t m_generation = 0;
+    bool m_stopping = false;
+};
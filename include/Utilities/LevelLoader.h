@@ -6,6 +6,7 @@
 #include <Box2D/Box2D.h>
 #include "Entity.h"
 #include "ResourceManager.h"
+#include "CompiledLevel.h"
 
 class EntityManager;
 class EntityFactory;
@@ -14,7 +15,8 @@ class LevelLoader {
 public:
     LevelLoader() = default;
 
-    // Updated load method to use EntityManager instead of GameObjectManager
+    // Updated load method to use EntityManager instead of GameObjectManager.
+    // Uses the compiled .lvlb next to a text level when it is at least as new.
     bool loadFromFile(const std::string& path,
         EntityManager& entityManager,
         b2World& world,
@@ -30,11 +32,23 @@ public:
 
     LevelInfo getLevelInfo(const std::string& path) const;
 
+    // Reads a level's spawn records (compiled or text) sorted by column, without
+    // creating anything; safe to call from a background thread
+    bool readSpawns(const std::string& path, std::vector<CompiledLevel::Spawn>& spawns) const;
+
+    // World position of a spawn record, as loadFromFile places it
+    sf::Vector2f spawnPosition(const CompiledLevel::Spawn& spawn) const;
+
 private:
     // Create entity based on character
     std::unique_ptr<Entity> createEntityForChar(char tileChar, float x, float y,
         b2World& world, TextureManager& textures);
 
+    // Compiled levels
+    std::string findCompiledLevel(const std::string& path) const;
+    void spawnCompiled(const CompiledLevel& level, EntityManager& entityManager) const;
+    sf::Vector2f spawnOffset(char tileChar) const;
+
     // Parsing helpers
     std::vector<std::string> readLevelFile(const std::string& path) const;
     bool isValidTileChar(char c) const;
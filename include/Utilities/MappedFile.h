@@ -0,0 +1,56 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/**
+ * @class MappedFile
+ * @brief A file mapped into memory, read-only or growable for writing.
+ *
+ * Thin wrapper over mmap (POSIX) and file mappings (Windows). A file opened
+ * for writing is created at an initial size and can be grown with resize();
+ * close() trims it to the bytes actually used. The data pointer is only valid
+ * until the next resize() or close().
+ */
+class MappedFile {
+public:
+    MappedFile() = default;
+    ~MappedFile();
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /** @brief Maps an existing file read-only. */
+    bool openRead(const std::string& path);
+
+    /** @brief Creates (or truncates) a file of the given size and maps it writable. */
+    bool create(const std::string& path, std::size_t size);
+
+    /** @brief Grows a writable mapping; the file is extended to match. */
+    bool resize(std::size_t size);
+
+    /**
+     * @brief Unmaps the file. A writable file is trimmed to usedSize bytes
+     *        (pass SIZE_MAX to keep its current size).
+     */
+    void close(std::size_t usedSize = SIZE_MAX);
+
+    bool isOpen() const { return m_data != nullptr; }
+    std::uint8_t* data() { return m_data; }
+    const std::uint8_t* data() const { return m_data; }
+    std::size_t size() const { return m_size; }
+
+private:
+    bool map(std::size_t size);
+    void unmap();
+
+    std::uint8_t* m_data = nullptr;
+    std::size_t m_size = 0;
+    bool m_writable = false;
+
+#ifdef _WIN32
+    void* m_file = nullptr;      // HANDLE
+    void* m_mapping = nullptr;   // HANDLE
+#else
+    int m_file = -1;
+#endif
+};
\ No newline at end of file
@@ -50,6 +50,17 @@ public:
         }
     }
 
+    // Register a resource created elsewhere under a file name; an already loaded one wins
+    Resource& adopt(const std::string& filename, std::unique_ptr<Resource> resource) {
+        auto it = m_resources.find(filename);
+        if (it != m_resources.end()) {
+            return *it->second;
+        }
+        Resource& ref = *resource;
+        m_resources[filename] = std::move(resource);
+        return ref;
+    }
+
     // Check if resource is already loaded
     bool isLoaded(const std::string& filename) const {
         return m_resources.find(filename) != m_resources.end();
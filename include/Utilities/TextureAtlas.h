@@ -0,0 +1,88 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "ResourceManager.h"
+
+/**
+ * @class TextureAtlas
+ * @brief Packs individual gameplay textures into a few large atlas pages.
+ *
+ * The atlas is built once at startup from a TextureManager. Each packed texture
+ * is remembered by address, so RenderComponent::setTexture can swap the caller's
+ * texture for its atlas page plus sub-rectangle without the caller noticing.
+ * Packed pages and their layout are written to a cache file and reused on the
+ * next start as long as none of the source files changed; the source textures
+ * are then cut out of the cached pages instead of being decoded again.
+ *
+ * Every region is surrounded by a copy of its own edge pixels, so filtering
+ * and scaled sprites sample the texture itself rather than its neighbours.
+ */
+class TextureAtlas {
+public:
+    /**
+     * @brief Location of a packed texture inside the atlas.
+     */
+    struct Region {
+        const sf::Texture* page = nullptr;  ///< Atlas page holding the texture.
+        sf::IntRect rect;                   ///< Pixel rectangle inside the page.
+    };
+
+    static TextureAtlas& instance();
+
+    /**
+     * @brief Packs the given textures into atlas pages.
+     * @param textures Manager owning the source textures (their addresses are used as keys).
+     * @param filenames Texture file names, spelled exactly as gameplay code requests them.
+     * @param cachePath Manifest file used to skip packing when sources are unchanged (empty = no cache).
+     * @return True if at least one texture was packed.
+     */
+    bool build(TextureManager& textures, const std::vector<std::string>& filenames,
+        const std::string& cachePath = "");
+
+    /**
+     * @brief Find the atlas region of a texture.
+     * @return Region pointer, or nullptr if the texture is not packed.
+     */
+    const Region* find(const sf::Texture& texture) const;
+
+    /** @brief Drop all pages and regions. */
+    void clear();
+
+    std::size_t getPageCount() const { return m_pages.size(); }
+    std::size_t getRegionCount() const { return m_regions.size(); }
+
+    /** @brief Default list of textures used by gameplay entities. */
+    static const std::vector<std::string>& gameplayTextures();
+
+private:
+    TextureAtlas() = default;
+
+    struct PackedEntry {
+        std::string filename;
+        std::size_t page = 0;
+        sf::IntRect rect;
+    };
+
+    bool pack(TextureManager& textures, const std::vector<std::string>& filenames,
+        std::vector<PackedEntry>& entries, std::vector<sf::Image>& pageImages);
+    bool loadCache(const std::string& cachePath, const std::vector<std::string>& filenames,
+        std::vector<PackedEntry>& entries, std::vector<sf::Image>& pageImages);
+    bool uploadPages(const std::vector<sf::Image>& pageImages);
+    static void adoptSources(TextureManager& textures, const std::vector<PackedEntry>& entries,
+        const std::vector<sf::Image>& pageImages);
+    static void extrude(sf::Image& page, const sf::IntRect& rect);
+    void saveCache(const std::string& cachePath, const std::vector<std::string>& filenames,
+        const std::vector<PackedEntry>& entries, const std::vector<sf::Image>& pageImages) const;
+    static std::string fileStamp(const std::string& filename);
+
+    static constexpr unsigned MAX_PAGE_SIZE = 4096;
+    static constexpr unsigned EXTRUDE = 1;     // Edge pixels repeated around each region
+    static constexpr unsigned PADDING = 2;     // Empty pixels between extruded regions
+    static constexpr int CACHE_VERSION = 2;
+
+    std::vector<std::unique_ptr<sf::Texture>> m_pages;
+    std::unordered_map<const sf::Texture*, Region> m_regions;
+};
@@ -1,6 +1,8 @@
 ﻿#include <Application/GameInitializer.h>
 #include <Services/Logger.h>
 #include <Screens/GameplayScreen.h>
+#include <Utilities/TextureAtlas.h>
+#include <Core/ResourcePaths.h>
 
 //-------------------------------------------------------------------------------------
 void GameInitializer::initializeAllSystems() {
@@ -83,6 +85,11 @@ void GameInitializer::initializeResourceSystem() {
         auto& fonts = AppContext::instance().fonts();
         auto& sounds = AppContext::instance().sounds();
 
+        if (!TextureAtlas::instance().build(textures, TextureAtlas::gameplayTextures(),
+                ResourcePaths::TEXTURE_ATLAS_CACHE)) {
+            Logger::log("Texture atlas unavailable, entities will use individual textures", LogLevel::Warning);
+        }
+
         Logger::log("Resource system initialized successfully");
     }
     catch (const std::exception& e) {
@@ -4,6 +4,7 @@
 #include "../Application/WindowManager.h"
 #include <Services/Logger.h>
 #include <Application/AppContext.h>
+#include "RenderThread.h"
 
 //-------------------------------------------------------------------------------------
 GameLoop::GameLoop(WindowManager& windowManager)
@@ -11,9 +12,15 @@ GameLoop::GameLoop(WindowManager& windowManager)
     Logger::log("GameLoop created");
 }
 //-------------------------------------------------------------------------------------
+GameLoop::~GameLoop() = default;
+//-------------------------------------------------------------------------------------
 void GameLoop::run() {
     Logger::log("Starting main game loop...");
 
+    // From here on the render thread owns the window's GL context
+    m_renderThread = std::make_unique<RenderThread>(m_windowManager.getWindow(),
+        m_windowManager.getFramerateLimit());
+
     try {
         while (m_windowManager.isWindowOpen()) {
             processFrame();
@@ -21,8 +28,10 @@ void GameLoop::run() {
     }
     catch (const std::exception& e) {
         Logger::log("Game loop error: " + std::string(e.what()), LogLevel::Error);
+        m_renderThread.reset();
         throw;
     }
+    m_renderThread.reset();
     Logger::log("Game loop ended");
 }
 //-------------------------------------------------------------------------------------
@@ -40,8 +49,11 @@ void GameLoop::updateGame(float deltaTime) {
     try {
         auto& screenManager = AppContext::instance().screenManager();
 
-        // Handle events first
-        screenManager.handleEvents(m_windowManager.getWindow());
+        // Handle events first; the render thread stays off the window meanwhile
+        {
+            RenderThread::WindowLock windowLock(m_renderThread.get());
+            screenManager.handleEvents(m_windowManager.getWindow());
+        }
 
         // Update current screen
         screenManager.update(deltaTime);
@@ -56,14 +68,23 @@ void GameLoop::renderGame() {
         auto& window = m_windowManager.getWindow();
         auto& screenManager = AppContext::instance().screenManager();
 
-        // Clear screen
-        window.clear(sf::Color::Black);
-
-        // Render current screen
-        screenManager.render(window);
+        if (!m_renderThread) {
+            window.clear(sf::Color::Black);
+            screenManager.render(window);
+            window.display();
+            return;
+        }
 
-        // Display frame
-        window.display();
+        // Record this frame; it is drawn while the next one is updated
+        RenderCommandList& commands = m_renderThread->beginFrame();
+        if (!screenManager.record(commands, window)) {
+            // Screens that draw themselves run on the render thread, and
+            // submitFrame() waits for them because they read live state
+            commands.addCallback([&screenManager, &window](sf::RenderTarget&) {
+                screenManager.render(window);
+            });
+        }
+        m_renderThread->submitFrame();
     }
     catch (const std::exception& e) {
         Logger::log("Render error: " + std::string(e.what()), LogLevel::Error);
@@ -34,6 +34,7 @@ void WindowManager::setFramerateLimit(unsigned int fps) {
         Logger::log("Cannot set framerate: Window not created", LogLevel::Warning);
         return;
     }
+    m_framerateLimit = fps;
     m_window->setFramerateLimit(fps);
     Logger::log("Framerate limit set to: " + std::to_string(fps));
 }
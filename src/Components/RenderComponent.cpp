@@ -1,8 +1,15 @@
 #include "RenderComponent.h"
+#include "TextureAtlas.h"
 
 //-------------------------------------------------------------------------------------
 void RenderComponent::setTexture(const sf::Texture& texture) {
-    m_sprite.setTexture(texture);
+    // Packed textures are drawn from their atlas page so sprites can share batches
+    if (const auto* region = TextureAtlas::instance().find(texture)) {
+        m_sprite.setTexture(*region->page);
+        m_sprite.setTextureRect(region->rect);
+        return;
+    }
+    m_sprite.setTexture(texture, true);
 }
 //-------------------------------------------------------------------------------------
 void RenderComponent::setSprite(const sf::Sprite& sprite) {
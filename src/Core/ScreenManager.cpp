@@ -1,4 +1,5 @@
 #include "ScreenManager.h"
+#include "RenderThread.h"
 
 //-------------------------------------------------------------------------------------
 void ScreenManager::registerScreen(ScreenType type, std::function<std::unique_ptr<IScreen>()> creator) {
@@ -11,6 +12,11 @@ void ScreenManager::changeScreen(ScreenType type) {
         return;
     }
 
+    // Frames still queued may reference the old screen's textures and fonts
+    if (auto* renderThread = RenderThread::current()) {
+        renderThread->waitIdle();
+    }
+
     if (m_currentScreen) {
         m_currentScreen->onExit();
     }
@@ -55,4 +61,11 @@ void ScreenManager::render(sf::RenderWindow& window) {
         m_currentScreen->render(window);
     }
 }
+//-------------------------------------------------------------------------------------
+bool ScreenManager::record(RenderCommandList& commands, sf::RenderWindow& window) {
+    if (!m_currentScreen) {
+        return true;  // Nothing to draw
+    }
+    return m_currentScreen->record(commands, window);
+}
 //-------------------------------------------------------------------------------------
\ No newline at end of file
@@ -19,6 +19,7 @@ void GiftEntity::setupComponents(float x, float y, TextureManager& textures) {
     auto* render = addComponent<RenderComponent>();
     std::string textureName = getTextureNameForType(m_giftType);
     render->setTexture(textures.getResource(textureName));
+    render->setLayer(RenderLayer::Items);
     auto& sprite = render->getSprite();
     sprite.setScale(0.2f, 0.2f);
     auto bounds = sprite.getLocalBounds();
@@ -77,6 +77,7 @@ void ProjectileEntity::setupComponents(b2World& world, float x, float y,
     // Rendering
     auto* render = addComponent<RenderComponent>();
     render->setTexture(textures.getResource("Bullet.png"));
+    render->setLayer(RenderLayer::Projectiles);
     auto& sprite = render->getSprite();
     
     if (withGravity) {
@@ -54,6 +54,7 @@ void FalconEnemyEntity::setupComponents(b2World& world, float x, float y, Textur
     // Setup rendering
     auto* render = addComponent<RenderComponent>();
     render->setTexture(*m_texture1);
+    render->setLayer(RenderLayer::Characters);
     auto& sprite = render->getSprite();
     sprite.setScale(-0.2f, 0.2f);
     sprite.setColor(sf::Color::White);
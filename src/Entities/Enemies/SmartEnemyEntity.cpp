@@ -12,6 +12,7 @@
 #include "PlayerState.h"
 #include "GameSession.h"
 #include "Constants.h"
+#include "RenderQueue.h"
 #include <iostream>
 #include <cmath>
 #include <algorithm>
@@ -60,6 +61,7 @@ void SmartEnemyEntity::setupComponents(b2World& world, float x, float y, Texture
     // Enhanced rendering - distinctive appearance
     auto* render = addComponent<RenderComponent>();
     render->setTexture(textures.getResource("SquareEnemy.png"));
+    render->setLayer(RenderLayer::Characters);
     auto& sprite = render->getSprite();
 
     // Larger and with distinctive coloring
@@ -477,7 +479,7 @@ void SmartEnemyEntity::executeEmergencyBehavior() {
 void SmartEnemyEntity::communicateWithNearbyEnemies() {
 }
 //-------------------------------------------------------------------------------------
-void SmartEnemyEntity::drawEyes(sf::RenderWindow& window) {
+void SmartEnemyEntity::appendEyes(RenderQueue& queue) const {
     if (!g_currentSession) {
         return;
     }
@@ -485,25 +487,11 @@ void SmartEnemyEntity::drawEyes(sf::RenderWindow& window) {
 
     if (darkness < 0.5f || !m_eyesVisible) return;
 
-    auto* transform = getComponent<Transform>();
-    if (!transform) {
-        return;
-    }
-
-    sf::Vector2f pos = transform->getPosition();
-
-    sf::Color leftColor = m_leftEye.getFillColor();
-    sf::Color rightColor = m_rightEye.getFillColor();
-
-    m_leftEye.setRadius(6.f);
-    m_rightEye.setRadius(6.f);
-    m_leftEye.setFillColor(sf::Color(255, 0, 0, 255)); 
-    m_rightEye.setFillColor(sf::Color(255, 0, 0, 255));
-    m_leftEye.setOutlineThickness(3.f);
-    m_rightEye.setOutlineThickness(3.f);
-
-    window.draw(m_leftEye);
-    window.draw(m_rightEye);
-
+    // Solid red eyes with an outline ring; the Effects layer keeps them visible above the darkness
+    const sf::Color eyeColor(255, 0, 0, 255);
+    const float radius = 6.f;
+    const float outline = 3.f;
+    queue.submitCircle(m_leftEye.getPosition(), radius, eyeColor, RenderLayer::Effects, outline, m_leftEye.getOutlineColor());
+    queue.submitCircle(m_rightEye.getPosition(), radius, eyeColor, RenderLayer::Effects, outline, m_rightEye.getOutlineColor());
 }
 //-------------------------------------------------------------------------------------
\ No newline at end of file
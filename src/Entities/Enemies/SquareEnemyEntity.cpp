@@ -46,6 +46,7 @@ void SquareEnemyEntity::setupComponents(b2World& world, float x, float y, Textur
 
     auto* render = addComponent<RenderComponent>();
     render->setTexture(textures.getResource("SquareEnemy2.png"));
+    render->setLayer(RenderLayer::Characters);
     auto& sprite = render->getSprite();
 
     float renderScale = sizeMultiplier * 0.3f;
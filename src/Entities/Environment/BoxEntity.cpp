@@ -37,7 +37,7 @@ void BoxEntity::setupComponents(b2World& world, float x, float y, TextureManager
     auto* render = addComponent<RenderComponent>();
     render->setTexture(textures.getResource("wooden_box.png"));
     auto& sprite = render->getSprite();
-    sf::Vector2u texSize = sprite.getTexture()->getSize();
+    sf::Vector2u texSize(sprite.getTextureRect().width, sprite.getTextureRect().height);
     float scaleX = BOX_SIZE / static_cast<float>(texSize.x);
     float scaleY = BOX_SIZE / static_cast<float>(texSize.y);
     sprite.setScale(scaleX, scaleY);
@@ -34,12 +34,13 @@ void CactusEntity::setupComponents(b2World& world, float x, float y, TextureMana
     float visualWidth = TILE_SIZE * 0.6f;   
     float visualHeight = TILE_SIZE * 0.8f; 
 
-    sf::Vector2u texSize = sprite.getTexture()->getSize();
+    sf::Vector2u texSize(sprite.getTextureRect().width, sprite.getTextureRect().height);
     float scaleX = visualWidth / static_cast<float>(texSize.x);
     float scaleY = visualHeight / static_cast<float>(texSize.y);
     sprite.setScale(scaleX, scaleY);
     sprite.setOrigin(texSize.x / 2.f, texSize.y / 2.f);
     sprite.setPosition(physicsX, physicsY);
+    render->setStatic(true);
 
     addComponent<CollisionComponent>(CollisionComponent::CollisionType::Hazard);
 }
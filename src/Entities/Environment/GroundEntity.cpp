@@ -7,48 +7,60 @@
 
 //-------------------------------------------------------------------------------------
 GroundEntity::GroundEntity(IdType id, TileType type, b2World& world, float x, float y, TextureManager& textures)
+    : GroundEntity(id, makePrototype(type, textures), world, x, y) {
+}
+//-------------------------------------------------------------------------------------
+GroundEntity::GroundEntity(IdType id, const Prototype& prototype, b2World& world, float x, float y)
     : Entity(id)
-    , m_tileType(type) {
-    setupComponents(type, world, x, y, textures);
+    , m_tileType(prototype.type) {
+    setupComponents(prototype, world, x, y);
 }
 //-------------------------------------------------------------------------------------
-void GroundEntity::setupComponents(TileType type, b2World& world, float x, float y, TextureManager& textures) {
-    std::string textureName = getTextureNameForType(type);
-    sf::Texture& texture = textures.getResource(textureName);
+GroundEntity::Prototype GroundEntity::makePrototype(TileType type, TextureManager& textures) {
+    Prototype prototype;
+    prototype.type = type;
+
+    sf::Texture& texture = textures.getResource(getTextureNameForType(type));
     sf::Vector2u texSize = texture.getSize();
     float texWidth = static_cast<float>(texSize.x);
     float texHeight = static_cast<float>(texSize.y);
 
-    float boxWidth = TILE_SIZE;
-    float boxHeight = TILE_SIZE;
-    float centerX = x + TILE_SIZE / 2.f;
-    float centerY = y + TILE_SIZE / 2.f;
+    prototype.boxSize = sf::Vector2f(TILE_SIZE, TILE_SIZE);
+    prototype.centerOffset = sf::Vector2f(TILE_SIZE / 2.f, TILE_SIZE / 2.f);
 
     if (type == TileType::Edge) {
-        boxWidth = texWidth;
-        boxHeight = texHeight;
-
-        centerX = x + boxWidth / 2.f;
-        centerY = y + TILE_SIZE - (boxHeight / 2.f);
+        prototype.boxSize = sf::Vector2f(texWidth, texHeight);
+        prototype.centerOffset = sf::Vector2f(texWidth / 2.f, TILE_SIZE - (texHeight / 2.f));
     }
 
+    // Resolve the atlas region through RenderComponent so tiles match other sprites
+    RenderComponent render;
+    render.setTexture(texture);
+    prototype.sprite = render.getSprite();
+    auto bounds = prototype.sprite.getLocalBounds();
+    prototype.sprite.setOrigin(bounds.width / 2.f, bounds.height / 2.f);
+    return prototype;
+}
+//-------------------------------------------------------------------------------------
+void GroundEntity::setupComponents(const Prototype& prototype, b2World& world, float x, float y) {
+    float centerX = x + prototype.centerOffset.x;
+    float centerY = y + prototype.centerOffset.y;
+
     addComponent<Transform>(sf::Vector2f(centerX, centerY));
 
     auto* physics = addComponent<PhysicsComponent>(world, b2_staticBody);
-    physics->createBoxShape(boxWidth, boxHeight);
+    physics->createBoxShape(prototype.boxSize.x, prototype.boxSize.y);
     physics->setPosition(centerX, centerY);
 
     auto* render = addComponent<RenderComponent>();
-    render->setTexture(texture);
-    auto& sprite = render->getSprite();
-    auto bounds = sprite.getLocalBounds();
-    sprite.setOrigin(bounds.width / 2.f, bounds.height / 2.f);
-    sprite.setPosition(centerX, centerY);
+    render->setSprite(prototype.sprite);
+    render->getSprite().setPosition(centerX, centerY);
+    render->setStatic(true);
 
     addComponent<CollisionComponent>(CollisionComponent::CollisionType::Ground);
 }
 //-------------------------------------------------------------------------------------
-std::string GroundEntity::getTextureNameForType(TileType type) const {
+std::string GroundEntity::getTextureNameForType(TileType type) {
     switch (type) {
     case TileType::Ground:  return "ground.png";
     case TileType::Middle:  return "middle.png";
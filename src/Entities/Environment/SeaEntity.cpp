@@ -27,6 +27,7 @@ void SeaEntity::setupComponents(b2World& world, float x, float y, TextureManager
     auto bounds = sprite.getLocalBounds();
     sprite.setOrigin(bounds.width / 2.f, bounds.height / 2.f);
     sprite.setPosition(centerX, centerY);
+    render->setStatic(true);
 
     addComponent<CollisionComponent>(CollisionComponent::CollisionType::Hazard);
 }
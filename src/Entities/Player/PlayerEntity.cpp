@@ -41,11 +41,12 @@ void PlayerEntity::setupComponents(b2World& world, float x, float y, TextureMana
     // Add rendering
     auto* render = addComponent<RenderComponent>();
     render->setTexture(textures.getResource("NormalBall.png"));
+    render->setLayer(RenderLayer::Characters);
     auto& sprite = render->getSprite();
 
     // Scale to desired size
     float desiredDiameter = PLAYER_RADIUS * 2 * PPM;
-    sf::Vector2u textureSize = sprite.getTexture()->getSize();
+    sf::Vector2u textureSize(sprite.getTextureRect().width, sprite.getTextureRect().height);
     float scaleX = desiredDiameter / textureSize.x;
     float scaleY = desiredDiameter / textureSize.y;
     sprite.setScale(scaleX, scaleY);
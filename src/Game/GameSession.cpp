@@ -5,6 +5,9 @@
 #include "FalconEnemyEntity.h"
 #include "Transform.h"
 #include "Constants.h"
+#include "EventSystem.h"
+#include "ThreadEventChannel.h"
+#include <cstdlib>
 #include <memory>
 #include <iostream>
 
@@ -43,8 +46,15 @@ GameSession::~GameSession() {
         // Clear all entities
         m_entityManager.clear();
 
-        // Clear any remaining event system listeners
-        EventSystem::getInstance().clear();
+        // Subscribers unsubscribe through their own handles; only drop
+        // events this session queued and never delivered
+        EventSystem::getInstance().discardQueued();
+
+        ThreadEventChannel::Stats channel = ThreadEventChannel::getInstance().getStats();
+        if (channel.dropped > 0 || channel.late > 0) {
+            std::cout << "[ThreadEventChannel] " << channel.delivered << " delivered, "
+                << channel.dropped << " dropped, " << channel.late << " late" << std::endl;
+        }
     }
     catch (const std::exception& e) {
 		std::cerr << "[ERROR] Exception during GameSession destruction: " << e.what() << std::endl;
@@ -64,6 +74,9 @@ void GameSession::initialize(TextureManager& textures, sf::RenderWindow& window)
 
     // 3. Event system
     m_eventCoordinator.initialize();
+    if (const char* tapePath = std::getenv("EVENT_TAPE")) {
+        m_eventTape = std::make_unique<EventTapeRecorder>(tapePath);
+    }
 
     // 4. Register entities for factory (needed for level loading)
     registerGameEntities(m_physicsManager.getWorld(), textures, m_entityManager);
@@ -79,8 +92,12 @@ void GameSession::update(float deltaTime) {
     updateAllSubsystems(deltaTime);
 }
 //-------------------------------------------------------------------------------------
-void GameSession::render(sf::RenderWindow& window) {
-    m_renderSystem.render(m_entityManager, window);
+void GameSession::updateLevelStreaming(const sf::View& camera) {
+    m_levelManager.updateStreaming(camera);
+}
+//-------------------------------------------------------------------------------------
+void GameSession::render(RenderQueue& queue, const sf::View& view) {
+    m_renderSystem.render(m_entityManager, queue, view);
 }
 //-------------------------------------------------------------------------------------
 PlayerEntity* GameSession::getPlayer() {
@@ -155,22 +172,32 @@ void GameSession::findAndCachePlayer() {
 void GameSession::updateAllSubsystems(float deltaTime) {
     // Coordinate all managers in proper order - no business logic!
 
-    // 1. Update physics world
+    if (m_eventTape) {
+        m_eventTape->beginFrame();
+    }
+
+    // 1. Deliver events posted by worker threads since the last frame
+    ThreadEventChannel::getInstance().drain(EventSystem::getInstance());
+
+    // 2. Update physics world
     m_physicsManager.update(deltaTime);
 
-    // 2. Update level manager (handles transitions)
+    // 3. Update level manager (handles transitions)
     m_levelManager.update(deltaTime);
 
     // Check timed spawns
     updateFalconSpawner(deltaTime);
 
-    // 3. Update all entities
+    // 4. Update all entities
     m_entityManager.updateAll(deltaTime);
 
-    // 4. Check collisions
+    // 5. Check collisions
     m_collisionManager.checkCollisions(m_entityManager);
 
-    // 5. Cleanup inactive entities
+    // 6. Deliver events queued during the frame, now that no iteration is in progress
+    EventSystem::getInstance().dispatchQueued();
+
+    // 7. Cleanup inactive entities
     m_cleanupManager.update(deltaTime);
     m_cleanupManager.cleanupInactiveEntities(m_entityManager);
 }
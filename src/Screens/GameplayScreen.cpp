@@ -8,6 +8,7 @@
 #include "GameEvents.h"
 #include "ResourcePaths.h"
 #include "PhysicsComponent.h"
+#include "RenderThread.h"
 #include <iostream>
 #include <format>
 #include <WellEntity.h>
@@ -35,6 +36,7 @@ T* GameplayScreen::getSafeComponent(Entity* entity) const {
  * to specialized methods
  */
 GameplayScreen::GameplayScreen() : 
+    m_textures(AppContext::instance().textures()),
     m_initialized(false),
     m_isUnderground(false),
     m_showingLevelComplete(false),
@@ -138,6 +140,11 @@ void GameplayScreen::initializeUITexts() {
     m_gameOverText.setOutlineThickness(2.0f);
     m_gameOverText.setOutlineColor(sf::Color::Black);
     m_gameOverText.setString("Press SPACE to restart");
+
+    // These texts are recorded, so their glyphs must be cached up front
+    RenderThread::prepareGlyphs(m_levelCompleteText);
+    RenderThread::prepareGlyphs(m_gameCompleteText);
+    RenderThread::prepareGlyphs(m_gameOverText);
 }
 
 /**
@@ -317,6 +324,16 @@ void GameplayScreen::update(float deltaTime) {
         return;
     }
 
+    // Bring level chunks near the camera in before physics runs. The camera
+    // is recentred on the player first: after a level switch or restart it
+    // still points where the previous run ended.
+    if (m_gameSession && m_cameraManager) {
+        if (PlayerEntity* current = m_gameSession->getPlayer()) {
+            updateCameraForPlayer(*current);
+        }
+        m_gameSession->updateLevelStreaming(m_cameraManager->getCamera());
+    }
+
     // Get player from the SRP-compliant GameSession
     PlayerEntity* player = m_gameSession ? m_gameSession->getPlayer() : nullptr;
     
@@ -370,15 +387,6 @@ void GameplayScreen::update(float deltaTime) {
         // Update dark level system
         if (m_darkLevelSystem && m_isUnderground) {
             m_darkLevelSystem->update(deltaTime, player);
-            
-            // Periodically update obstacle positions for moving objects
-            static float obstacleUpdateTimer = 0.0f;
-            obstacleUpdateTimer += deltaTime;
-            
-            if (obstacleUpdateTimer > 1.0f) { // Update every second
-                registerShadowCastingObjects();
-                obstacleUpdateTimer = 0.0f;
-            }
         }
         
         // Check game over condition with the latest player reference
@@ -392,29 +400,18 @@ void GameplayScreen::update(float deltaTime) {
 }
 
 /**
- * Register objects that should cast shadows in the dark level
+ * Register objects that should cast shadows in the dark level.
+ * The dark level system follows the session's entities from here on, so
+ * spawned, moved and destroyed ground/obstacles update their shadows.
  */
 void GameplayScreen::registerShadowCastingObjects() {
-    if (!m_darkLevelSystem) {
+    if (!m_darkLevelSystem || !m_gameSession) {
         return;
     }
-    
-    // Clear existing obstacles
-    m_darkLevelSystem->clearObstacles();
-    
-    // Create a simplified set of obstacles for the dark level
-    std::vector<sf::FloatRect> obstacles;
-    
-    // Add some fixed obstacles for now
-    obstacles.push_back(sf::FloatRect(100, 300, 200, 50));  // Ground platform
-    obstacles.push_back(sf::FloatRect(400, 250, 150, 30));  // Floating platform
-    obstacles.push_back(sf::FloatRect(700, 400, 300, 100)); // Large obstacle
-    
-    // Register obstacles with the dark level system
-    if (!obstacles.empty()) {
-        m_darkLevelSystem->setObstacles(obstacles);
-        std::cout << "[GameplayScreen] Registered " << obstacles.size() << " shadow casting objects" << std::endl;
-    }
+
+    m_darkLevelSystem->attach(m_gameSession->getEntityManager());
+    std::cout << "[GameplayScreen] Shadow casters follow "
+              << m_gameSession->getEntityManager().getAllEntities().size() << " level entities" << std::endl;
 }
 
 /**
@@ -484,6 +481,8 @@ void GameplayScreen::activateDarkLevelIfNeeded(const std::string& levelName) {
         // Reset dark level settings for normal levels
         if (m_darkLevelSystem) {
             m_darkLevelSystem->setEnabled(false);
+            // update() does not run while disabled, so spawns would only pile up
+            m_darkLevelSystem->detach();
             m_isUnderground = false;
         }
     }
@@ -592,19 +591,42 @@ void GameplayScreen::checkGameOverCondition(PlayerEntity* player) {
 }
 
 /**
- * Render the game screen
- * Follows a layered rendering approach for proper z-ordering
+ * Render the game screen directly, for callers without a render thread
  * @param window The render window
  */
 void GameplayScreen::render(sf::RenderWindow& window) {
-    // Set camera view
-    m_cameraManager->setView(window);
+    m_directCommands.clear();
+    record(m_directCommands, window);
+    m_directCommands.replay(window);
+}
 
-    // Render background
-    m_backgroundRenderer->render(window, m_cameraManager->getCamera());
+/**
+ * Record the game screen for the render thread
+ * Everything is submitted to the render queue by layer and recorded in one
+ * sorted flush at the end, so z-order no longer depends on call order.
+ * The window itself is only read here, never drawn to.
+ * @param commands List receiving the frame
+ * @param window The render window
+ * @return Always true; the whole screen records
+ */
+bool GameplayScreen::record(RenderCommandList& commands, sf::RenderWindow& window) {
+    // The camera is applied through the queue's layer views; it is also
+    // used below to map the mouse into world space
+    const sf::View& camera = m_cameraManager->getCamera();
+
+    m_renderQueue.begin();
+    for (std::size_t layer = 0; layer < static_cast<std::size_t>(RenderLayer::UI); ++layer) {
+        m_renderQueue.setLayerView(static_cast<RenderLayer>(layer), camera);
+    }
+    m_renderQueue.setLayerView(RenderLayer::UI, window.getDefaultView());
 
-    // Render game session (uses SRP RenderSystem internally)
-    m_gameSession->render(window);
+    // Background
+    m_renderQueue.submitPass(RenderLayer::Background, 0, [this, camera](RenderCommandList& passCommands) {
+        m_backgroundRenderer->render(passCommands, camera);
+    });
+
+    // Game session entities (culled and layered by the RenderSystem)
+    m_gameSession->render(m_renderQueue, camera);
 
     // Debug: Print dark level system status occasionally
     static int frameCount = 0;
@@ -614,7 +636,9 @@ void GameplayScreen::render(sf::RenderWindow& window) {
                   << " - Dark system: " << (m_darkLevelSystem ? "exists" : "null")
                   << ", Underground: " << (m_isUnderground ? "yes" : "no");
         if (m_darkLevelSystem) {
-            std::cout << ", Enabled: " << (m_darkLevelSystem->isEnabled() ? "yes" : "no");
+            std::cout << ", Enabled: " << (m_darkLevelSystem->isEnabled() ? "yes" : "no")
+                      << ", Lighting: " << m_darkLevelSystem->getAverageLightingTime() << " ms"
+                      << " (quality " << m_darkLevelSystem->getQualityLevel() << ")";
         }
         std::cout << std::endl;
     }
@@ -639,7 +663,7 @@ void GameplayScreen::render(sf::RenderWindow& window) {
                 // If mouse input is available, use it for flashlight direction
                 if (m_window) {
                     sf::Vector2i mousePos = sf::Mouse::getPosition(*m_window);
-                    sf::Vector2f worldPos = m_window->mapPixelToCoords(mousePos);
+                    sf::Vector2f worldPos = m_window->mapPixelToCoords(mousePos, camera);
                     m_darkLevelSystem->updateFlashlightDirection(playerPos, worldPos);
                 }
                 
@@ -650,37 +674,41 @@ void GameplayScreen::render(sf::RenderWindow& window) {
             }
         }
         
-        m_darkLevelSystem->render(window);
-        m_darkLevelSystem->drawRedEyes(window, m_gameSession->getEntityManager());
-    }
-
-    // Switch to UI view
-    sf::View defaultView = window.getDefaultView();
-    window.setView(defaultView);
-
-    // Render UI elements
-    m_ui->draw(window);
-
-    // Render UI observer notifications
-    if (m_uiObserver) {
-        m_uiObserver->render(window);
+        // Enemy eyes are queued on the Effects layer, above this darkness pass
+        m_renderQueue.submitPass(RenderLayer::Lighting, 0, [this, camera](RenderCommandList& passCommands) {
+            m_darkLevelSystem->render(passCommands, camera);
+        });
     }
 
-    // Render appropriate messages based on game state
-    renderGameMessages(window);
-
+    // UI layer, in screen space; depth keeps the original overlay order
+    const sf::View screenView = window.getDefaultView();
+    const sf::Vector2u windowSize = window.getSize();
+    m_renderQueue.submitPass(RenderLayer::UI, 0, [this, screenView, windowSize](RenderCommandList& passCommands) {
+        m_ui->draw(passCommands, screenView);
+        if (m_uiObserver) {
+            m_uiObserver->render(passCommands, windowSize);
+        }
+    });
+    m_renderQueue.submitPass(RenderLayer::UI, 1, [this](RenderCommandList& passCommands) {
+        renderGameMessages(passCommands);
+    });
     if (m_showHelpImage) {
-        window.draw(m_helpSprite);
+        m_renderQueue.submitPass(RenderLayer::UI, 2, [this](RenderCommandList& passCommands) {
+            passCommands.draw(m_helpSprite);
+        });
     }
+
+    m_renderQueue.flush(commands);
+    return true;
 }
 
 /**
  * Render game messages (level complete, game complete, game over)
- * @param window The render window
+ * @param commands List receiving the draws
  */
-void GameplayScreen::renderGameMessages(sf::RenderWindow& window) {
+void GameplayScreen::renderGameMessages(RenderCommandList& commands) {
     if (m_showingLevelComplete) {
-        window.draw(m_messageBackground);
+        commands.draw(m_messageBackground);
 
         // Animate text with pulsing effect using sine wave
         float alpha = 0.8f + 0.2f * std::sin(m_messageTimer * 8.0f);
@@ -688,18 +716,18 @@ void GameplayScreen::renderGameMessages(sf::RenderWindow& window) {
         color.a = static_cast<sf::Uint8>(255 * alpha);
         m_levelCompleteText.setFillColor(color);
 
-        window.draw(m_levelCompleteText);
+        commands.draw(m_levelCompleteText);
     }
 
     if (m_showingGameComplete) {
-        window.draw(m_messageBackground);
-        window.draw(m_gameCompleteText);
+        commands.draw(m_messageBackground);
+        commands.draw(m_gameCompleteText);
     }
 
     if (m_showingGameOver) {
-        window.draw(m_gameOverBackground);
-        window.draw(m_gameOverSprite);
-        window.draw(m_gameOverText);
+        commands.draw(m_gameOverBackground);
+        commands.draw(m_gameOverSprite);
+        commands.draw(m_gameOverText);
     }
 }
 
@@ -872,26 +900,28 @@ void GameplayScreen::updateUI(PlayerEntity& player) {
  * Uses observer pattern via event system
  */
 void GameplayScreen::setupLevelEventHandlers() {
+    m_eventSubscriptions.clear();
+
     // Level transition events
-    EventSystem::getInstance().subscribe<LevelTransitionEvent>(
+    m_eventSubscriptions.push_back(EventSystem::getInstance().subscribe<LevelTransitionEvent>(
         [this](const LevelTransitionEvent& event) {
             this->onLevelTransition(event);
         }
-    );
+    ));
 
     // Flag reached events
-    EventSystem::getInstance().subscribe<FlagReachedEvent>(
+    m_eventSubscriptions.push_back(EventSystem::getInstance().subscribe<FlagReachedEvent>(
         [this](const FlagReachedEvent& ) {
             this->showLevelCompleteMessage();
         }
-    );
+    ));
 
     // Well entered events
-    EventSystem::getInstance().subscribe<WellEnteredEvent>(
+    m_eventSubscriptions.push_back(EventSystem::getInstance().subscribe<WellEnteredEvent>(
         [this](const WellEnteredEvent& event) {
             this->handleWellEnteredEvent(event);
         }
-    );
+    ));
 }
 
 /**
@@ -979,13 +1009,14 @@ void GameplayScreen::showGameCompleteMessage() {
     m_messageTimer = 0.0f;
 
     // Get player score if available
+    // Re-layout the text only when the score shown differs from last time
     PlayerEntity* player = m_gameSession->getPlayer();
-    if (player) {
-        std::string completeText = std::format("Game Complete!\nFinal Score: {}", player->getScore());
-        m_gameCompleteText.setString(completeText);
+    if (player && player->getScore() != m_gameCompleteScore) {
+        m_gameCompleteScore = player->getScore();
+        m_gameCompleteText.setString(std::format("Game Complete!\nFinal Score: {}", m_gameCompleteScore));
     }
 
-    // Center the text
+    // Center the text (bounds are cached by sf::Text while the string is unchanged)
     sf::FloatRect bounds = m_gameCompleteText.getLocalBounds();
     m_gameCompleteText.setOrigin(bounds.width / 2.0f, bounds.height / 2.0f);
     m_gameCompleteText.setPosition(WINDOW_WIDTH / 2.0f, WINDOW_HEIGHT / 2.0f);
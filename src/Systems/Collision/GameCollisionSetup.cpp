@@ -47,7 +47,9 @@ void setupGameCollisionHandlers(MultiMethodCollisionSystem& collisionSystem) {
             coin.onCollect(&player);
             AudioManager::instance().playSound("coin");
 
-            EventSystem::getInstance().publish(
+            // Queued: the surprise box may block and spawn entities,
+            // which must not happen while collisions are being iterated
+            EventSystem::getInstance().enqueue(
                 CoinCollectedEvent(player.getId(), 1)
             );
         }
@@ -529,8 +531,18 @@ void registerGameEntities(b2World& world, TextureManager& textures, EntityManage
         return std::make_unique<PlayerEntity>(entityManager.generateId(), world, x, y, textures);
         });
 
-    // Register Coin
-    factory.registerCreator("C", [&](float x, float y) -> std::unique_ptr<Entity> {
+    // Register Coin; the sprite is prepared once and copied into each coin
+    sf::Sprite coinSprite;
+    {
+        RenderComponent prototype;
+        prototype.setTexture(textures.getResource("Coin.png"));
+        coinSprite = prototype.getSprite();
+        coinSprite.setScale(0.08f, 0.08f);
+        auto bounds = coinSprite.getLocalBounds();
+        coinSprite.setOrigin(bounds.width / 2.0f, bounds.height / 2.0f);
+    }
+
+    factory.registerCreator('C', [&, coinSprite](float x, float y) -> std::unique_ptr<Entity> {
         auto entity = std::make_unique<CoinEntity>(entityManager.generateId());
 
         sf::Vector2f coinPosition(x + TILE_SIZE / 4.f, y + TILE_SIZE / 4.f);
@@ -549,12 +561,9 @@ void registerGameEntities(b2World& world, TextureManager& textures, EntityManage
 
         auto* render = entity->addComponent<RenderComponent>();
         if (render) {
-            render->setTexture(textures.getResource("Coin.png"));
-            auto& sprite = render->getSprite();
-            sprite.setScale(0.08f, 0.08f);
-            auto bounds = sprite.getLocalBounds();
-            sprite.setOrigin(bounds.width / 2.0f, bounds.height / 2.0f);
-            sprite.setPosition(coinPosition);
+            render->setSprite(coinSprite);
+            render->setLayer(RenderLayer::Items);
+            render->getSprite().setPosition(coinPosition);
         }
 
         entity->addComponent<CollisionComponent>(CollisionComponent::CollisionType::Collectible);
@@ -562,53 +571,53 @@ void registerGameEntities(b2World& world, TextureManager& textures, EntityManage
         });
 
     // Register Gifts
-    auto registerGift = [&](const std::string& levelChar, GiftEntity::GiftType type) {
+    auto registerGift = [&](char levelChar, GiftEntity::GiftType type) {
         factory.registerCreator(levelChar, [&, type](float x, float y) -> std::unique_ptr<Entity> {
             return std::make_unique<GiftEntity>(entityManager.generateId(), type, x, y, textures);
             });
         };
 
-    registerGift("h", GiftEntity::GiftType::LifeHeart);
-    registerGift("s", GiftEntity::GiftType::SpeedBoost);
-    registerGift("p", GiftEntity::GiftType::Shield);
-    registerGift("*", GiftEntity::GiftType::RareCoin);
-    registerGift("r", GiftEntity::GiftType::ReverseMovement);
-    registerGift("w", GiftEntity::GiftType::HeadwindStorm);
-    registerGift("m", GiftEntity::GiftType::Magnetic);
-
-    // Register Ground Tiles
-    auto registerGround = [&](const std::string& levelChar, TileType type) {
-        factory.registerCreator(levelChar, [&, type](float x, float y) -> std::unique_ptr<Entity> {
-            return std::make_unique<GroundEntity>(entityManager.generateId(), type, world, x, y, textures);
+    registerGift('h', GiftEntity::GiftType::LifeHeart);
+    registerGift('s', GiftEntity::GiftType::SpeedBoost);
+    registerGift('p', GiftEntity::GiftType::Shield);
+    registerGift('*', GiftEntity::GiftType::RareCoin);
+    registerGift('r', GiftEntity::GiftType::ReverseMovement);
+    registerGift('w', GiftEntity::GiftType::HeadwindStorm);
+    registerGift('m', GiftEntity::GiftType::Magnetic);
+
+    // Register Ground Tiles from per-type prototypes
+    auto registerGround = [&](char levelChar, TileType type) {
+        factory.registerCreator(levelChar, [&, prototype = GroundEntity::makePrototype(type, textures)](float x, float y) -> std::unique_ptr<Entity> {
+            return std::make_unique<GroundEntity>(entityManager.generateId(), prototype, world, x, y);
             });
         };
 
-    registerGround("G", TileType::Ground);
-    registerGround("L", TileType::Left);
-    registerGround("R", TileType::Right);
-    registerGround("M", TileType::Middle);
-    registerGround("E", TileType::Edge);
+    registerGround('G', TileType::Ground);
+    registerGround('L', TileType::Left);
+    registerGround('R', TileType::Right);
+    registerGround('M', TileType::Middle);
+    registerGround('E', TileType::Edge);
 
     // Register remaining entity types
-    factory.registerCreator("S", [&](float x, float y) -> std::unique_ptr<Entity> {
+    factory.registerCreator('S', [&](float x, float y) -> std::unique_ptr<Entity> {
         return std::make_unique<SeaEntity>(entityManager.generateId(), world, x, y, textures);
         });
 
-    factory.registerCreator("X", [&](float x, float y) -> std::unique_ptr<Entity> {
+    factory.registerCreator('X', [&](float x, float y) -> std::unique_ptr<Entity> {
         return std::make_unique<FlagEntity>(entityManager.generateId(), world, x, y, textures);
         });
 
-    factory.registerCreator("c", [&](float x, float y) -> std::unique_ptr<Entity> {
+    factory.registerCreator('c', [&](float x, float y) -> std::unique_ptr<Entity> {
         return std::make_unique<CactusEntity>(entityManager.generateId(), world, x, y, textures);
         });
 
-    factory.registerCreator("B", [&](float x, float y) -> std::unique_ptr<Entity> {
+    factory.registerCreator('B', [&](float x, float y) -> std::unique_ptr<Entity> {
         return std::make_unique<BoxEntity>(entityManager.generateId(), world, x, y, textures);
 
         });
 
     // Register Square Enemy
-    factory.registerCreator("z", [&](float x, float y) -> std::unique_ptr<Entity> {
+    factory.registerCreator('z', [&](float x, float y) -> std::unique_ptr<Entity> {
         auto enemy = std::make_unique<SquareEnemyEntity>(
             entityManager.generateId(),
             world,
@@ -621,19 +630,19 @@ void registerGameEntities(b2World& world, TextureManager& textures, EntityManage
     );
 
     // Register Smart Enemy
-    factory.registerCreator("Z", [&](float x, float y) -> std::unique_ptr<Entity> {
+    factory.registerCreator('Z', [&](float x, float y) -> std::unique_ptr<Entity> {
         auto enemy = std::make_unique<SmartEnemyEntity>(entityManager.generateId(), world, x, y, textures);
         return enemy;
         });
 
     // Register Falcon Enemy
-    factory.registerCreator("F", [&](float x, float y) -> std::unique_ptr<Entity> {
+    factory.registerCreator('F', [&](float x, float y) -> std::unique_ptr<Entity> {
         auto enemy = std::make_unique<FalconEnemyEntity>(entityManager.generateId(), world, x, y, textures);
         return enemy;
         });
 
     // Register Well
-    factory.registerCreator("W", [&](float x, float y) -> std::unique_ptr<Entity> {
+    factory.registerCreator('W', [&](float x, float y) -> std::unique_ptr<Entity> {
         return std::make_unique<WellEntity>(entityManager.generateId(), world, x, y, textures);
         });
 }
\ No newline at end of file
@@ -6,6 +6,68 @@ EventSystem& EventSystem::getInstance() {
     return *instance;
 }
 
+void EventSystem::dispatchQueued() {
+    // Handlers may queue follow-up events; keep going until nothing is left,
+    // with a cap so two handlers re-queueing each other cannot hang the frame
+    constexpr int MAX_ROUNDS = 8;
+    for (int round = 0; round < MAX_ROUNDS && getQueuedCount() > 0; ++round) {
+        // Index loop: a handler may queue a new event type and grow the list
+        for (std::size_t i = 0; i < m_queueOrder.size(); ++i) {
+            if (m_queueOrder[i]->queuedCount() > 0) {
+                m_queueOrder[i]->dispatchQueued();
+            }
+        }
+    }
+}
+
+void EventSystem::discardQueued() {
+    for (IChannel* channel : m_queueOrder) {
+        channel->discardQueued();
+    }
+}
+
+std::size_t EventSystem::getQueuedCount() const {
+    std::size_t count = 0;
+    for (const IChannel* channel : m_queueOrder) {
+        count += channel->queuedCount();
+    }
+    return count;
+}
+
 void EventSystem::clear() {
-    m_listeners.clear();
+    m_queueOrder.clear();
+    m_channels.clear();
+}
+
+void EventSystem::unsubscribe(std::size_t typeId, std::uint32_t id) {
+    // The channel is gone after clear(); the handle has nothing left to undo
+    if (typeId < m_channels.size() && m_channels[typeId]) {
+        m_channels[typeId]->remove(id);
+    }
+}
+
+EventSubscription::EventSubscription(EventSubscription&& other) noexcept
+    : m_typeId(other.m_typeId), m_id(other.m_id) {
+    other.m_id = 0;
+}
+
+EventSubscription& EventSubscription::operator=(EventSubscription&& other) noexcept {
+    if (this != &other) {
+        reset();
+        m_typeId = other.m_typeId;
+        m_id = other.m_id;
+        other.m_id = 0;
+    }
+    return *this;
+}
+
+EventSubscription::~EventSubscription() {
+    reset();
+}
+
+void EventSubscription::reset() {
+    if (m_id != 0) {
+        EventSystem::getInstance().unsubscribe(m_typeId, m_id);
+        m_id = 0;
+    }
 }
\ No newline at end of file
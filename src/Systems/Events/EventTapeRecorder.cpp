@@ -0,0 +1,239 @@
+#include "EventTapeRecorder.h"
+#include "GameEvents.h"
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+
+namespace {
+    constexpr std::size_t INITIAL_FILE_SIZE = 1 << 20;
+
+    const char* typeName(EventTape::Type type) {
+        switch (type) {
+        case EventTape::Type::ScoreChanged: return "ScoreChanged";
+        case EventTape::Type::PlayerDied: return "PlayerDied";
+        case EventTape::Type::ItemCollected: return "ItemCollected";
+        case EventTape::Type::EnemyKilled: return "EnemyKilled";
+        case EventTape::Type::LevelCompleted: return "LevelCompleted";
+        case EventTape::Type::PlayerStateChanged: return "PlayerStateChanged";
+        case EventTape::Type::CoinCollected: return "CoinCollected";
+        case EventTape::Type::FlagReached: return "FlagReached";
+        case EventTape::Type::LevelTransition: return "LevelTransition";
+        case EventTape::Type::WellEntered: return "WellEntered";
+        case EventTape::Type::LevelParsed: return "LevelParsed";
+        default: return "Unknown";
+        }
+    }
+}
+
+/**
+ * Appends one record's payload after its header and patches the size in
+ */
+class EventTapeRecorder::PayloadWriter {
+public:
+    explicit PayloadWriter(std::vector<std::uint8_t>& out) : m_out(out) {}
+
+    template<typename T>
+    void put(T value) {
+        std::size_t at = m_out.size();
+        m_out.resize(at + sizeof(T));
+        EventTape::write(m_out.data() + at, value);
+    }
+
+    void put(const std::string& text) {
+        std::size_t length = std::min<std::size_t>(text.size(), 0xFFFF);
+        put(static_cast<std::uint16_t>(length));
+        m_out.insert(m_out.end(), text.begin(), text.begin() + length);
+    }
+
+private:
+    std::vector<std::uint8_t>& m_out;
+};
+
+//-------------------------------------------------------------------------------------
+EventTapeRecorder::EventTapeRecorder(const std::string& path)
+    : m_path(path), m_start(std::chrono::steady_clock::now()) {
+    if (!m_file.create(path, INITIAL_FILE_SIZE)) {
+        std::cerr << "[EventTape] Could not create " << path << std::endl;
+        return;
+    }
+    writeHeader();
+    m_recording = true;
+    m_frameRecords.reserve(4096);
+    m_writer = std::thread(&EventTapeRecorder::writerLoop, this);
+
+    track<ScoreChangedEvent>(EventTape::Type::ScoreChanged, [](const ScoreChangedEvent& e, PayloadWriter& out) {
+        out.put<std::int32_t>(e.newScore);
+        out.put<std::int32_t>(e.delta);
+    });
+    track<PlayerDiedEvent>(EventTape::Type::PlayerDied, [](const PlayerDiedEvent& e, PayloadWriter& out) {
+        out.put<std::uint32_t>(e.playerId);
+    });
+    track<ItemCollectedEvent>(EventTape::Type::ItemCollected, [](const ItemCollectedEvent& e, PayloadWriter& out) {
+        out.put<std::uint32_t>(e.collectorId);
+        out.put<std::uint32_t>(e.itemId);
+        out.put<std::uint8_t>(static_cast<std::uint8_t>(e.type));
+    });
+    track<EnemyKilledEvent>(EventTape::Type::EnemyKilled, [](const EnemyKilledEvent& e, PayloadWriter& out) {
+        out.put<std::uint32_t>(e.enemyId);
+        out.put<std::uint32_t>(e.killerId);
+    });
+    track<LevelCompletedEvent>(EventTape::Type::LevelCompleted, [](const LevelCompletedEvent& e, PayloadWriter& out) {
+        out.put(e.levelName);
+        out.put<std::int32_t>(e.finalScore);
+        out.put<float>(e.completionTime);
+    });
+    track<PlayerStateChangedEvent>(EventTape::Type::PlayerStateChanged, [](const PlayerStateChangedEvent& e, PayloadWriter& out) {
+        out.put(e.oldStateName);
+        out.put(e.newStateName);
+    });
+    track<CoinCollectedEvent>(EventTape::Type::CoinCollected, [](const CoinCollectedEvent& e, PayloadWriter& out) {
+        out.put<std::uint32_t>(e.playerId);
+        out.put<std::int32_t>(e.totalCoins);
+    });
+    track<FlagReachedEvent>(EventTape::Type::FlagReached, [](const FlagReachedEvent& e, PayloadWriter& out) {
+        out.put<std::uint32_t>(e.playerId);
+        out.put<std::uint32_t>(e.flagId);
+        out.put(e.currentLevel);
+    });
+    track<LevelTransitionEvent>(EventTape::Type::LevelTransition, [](const LevelTransitionEvent& e, PayloadWriter& out) {
+        out.put(e.fromLevel);
+        out.put(e.toLevel);
+        out.put<std::uint8_t>(e.isGameComplete ? 1 : 0);
+    });
+    track<WellEnteredEvent>(EventTape::Type::WellEntered, [](const WellEnteredEvent& e, PayloadWriter& out) {
+        out.put<std::uint32_t>(e.playerId);
+        out.put<std::uint32_t>(e.wellId);
+        out.put(e.targetLevel);
+    });
+    track<LevelParsedEvent>(EventTape::Type::LevelParsed, [](const LevelParsedEvent& e, PayloadWriter& out) {
+        out.put(e.levelPath);
+        out.put<std::uint32_t>(static_cast<std::uint32_t>(e.spawnCount));
+        out.put<float>(e.parseMs);
+        out.put<std::uint8_t>(e.ok ? 1 : 0);
+    });
+
+    std::cout << "[EventTape] Recording events to " << path << std::endl;
+}
+//-------------------------------------------------------------------------------------
+EventTapeRecorder::~EventTapeRecorder() {
+    m_subscriptions.clear();
+    if (!m_writer.joinable()) {
+        return;
+    }
+
+    beginFrame();   // Hand over whatever the last frame recorded
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopping = true;
+    }
+    m_wake.notify_one();
+    if (m_writer.joinable()) {
+        m_writer.join();
+    }
+    m_file.close(m_used);
+    std::cout << "[EventTape] Wrote " << m_eventCount << " events over " << m_frame
+        << " frames (" << m_used << " bytes) to " << m_path;
+    if (m_droppedCount > 0) {
+        std::cout << "; dropped " << m_droppedCount << " with payloads over 65535 bytes";
+    }
+    std::cout << std::endl;
+}
+//-------------------------------------------------------------------------------------
+template<typename TEvent, typename Encode>
+void EventTapeRecorder::track(EventTape::Type type, Encode encode) {
+    m_subscriptions.push_back(EventSystem::getInstance().subscribe<TEvent>(
+        [this, type, encode](const TEvent& event) {
+            if (!m_recording) {
+                return;     // The writer gave up; beginFrame() unsubscribes
+            }
+            EventTape::RecordHeader header;
+            header.type = type;
+            header.frame = m_frame;
+            header.micros = static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now() - m_start).count());
+
+            std::size_t at = m_frameRecords.size();
+            m_frameRecords.resize(at + EventTape::RECORD_HEADER_SIZE);
+            PayloadWriter out(m_frameRecords);
+            encode(event, out);
+
+            // The record header stores the size in 16 bits; larger payloads are dropped, not truncated
+            const std::size_t payloadSize = m_frameRecords.size() - at - EventTape::RECORD_HEADER_SIZE;
+            if (payloadSize > 0xFFFF) {
+                m_frameRecords.resize(at);
+                ++m_droppedCount;
+                return;
+            }
+            header.payloadSize = static_cast<std::uint16_t>(payloadSize);
+            EventTape::writeRecordHeader(m_frameRecords.data() + at, header);
+            ++m_eventCount;
+        }
+    ));
+}
+//-------------------------------------------------------------------------------------
+void EventTapeRecorder::beginFrame() {
+    ++m_frame;
+    if (!m_recording) {
+        // Stopped by the writer: nothing more will be written, so stop collecting
+        if (!m_subscriptions.empty()) {
+            m_subscriptions.clear();
+            std::vector<std::uint8_t>().swap(m_frameRecords);
+            std::lock_guard<std::mutex> lock(m_mutex);
+            std::vector<std::uint8_t>().swap(m_pending);
+        }
+        return;
+    }
+    if (m_frameRecords.empty()) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_pending.insert(m_pending.end(), m_frameRecords.begin(), m_frameRecords.end());
+    }
+    m_frameRecords.clear();
+    m_wake.notify_one();
+}
+//-------------------------------------------------------------------------------------
+void EventTapeRecorder::writeHeader() {
+    std::vector<std::uint8_t> header(EventTape::MAGIC, EventTape::MAGIC + 4);
+    PayloadWriter out(header);
+    out.put<std::uint16_t>(EventTape::VERSION);
+    out.put<std::uint16_t>(static_cast<std::uint16_t>(EventTape::Type::Count) - 1);
+    for (std::uint8_t id = 1; id < static_cast<std::uint8_t>(EventTape::Type::Count); ++id) {
+        const char* name = typeName(static_cast<EventTape::Type>(id));
+        std::size_t length = std::strlen(name);
+        header.push_back(id);
+        header.push_back(static_cast<std::uint8_t>(length));
+        header.insert(header.end(), name, name + length);
+    }
+
+    std::memcpy(m_file.data(), header.data(), header.size());
+    m_used = header.size();
+}
+//-------------------------------------------------------------------------------------
+void EventTapeRecorder::writerLoop() {
+    std::vector<std::uint8_t> batch;
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_wake.wait(lock, [this] { return !m_pending.empty() || m_stopping; });
+            if (m_pending.empty()) {
+                return;     // Stopping and everything is written
+            }
+            batch.swap(m_pending);
+        }
+
+        if (m_used + batch.size() > m_file.size()) {
+            std::size_t size = std::max(m_file.size() * 2, m_used + batch.size());
+            if (!m_file.resize(size)) {
+                std::cerr << "[EventTape] Could not grow " << m_path << "; recording stopped" << std::endl;
+                m_recording = false;
+                return;
+            }
+        }
+        std::memcpy(m_file.data() + m_used, batch.data(), batch.size());
+        m_used += batch.size();
+        batch.clear();
+    }
+}
+//-------------------------------------------------------------------------------------
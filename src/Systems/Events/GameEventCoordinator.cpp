@@ -21,6 +21,8 @@ void GameEventCoordinator::initialize() {
 void GameEventCoordinator::shutdown() {
     if (!m_initialized) return;
 
+    m_levelCompleteSubscription.reset();
+    m_playerDeathSubscription.reset();
     m_levelCompleteHandler = nullptr;
     m_playerDeathHandler = nullptr;
     m_initialized = false;
@@ -58,7 +60,7 @@ void GameEventCoordinator::setPlayerDeathHandler(std::function<void(const Player
 }
 //-------------------------------------------------------------------------------------
 void GameEventCoordinator::setupDefaultHandlers() {
-    EventSystem::getInstance().subscribe<LevelCompletedEvent>(
+    m_levelCompleteSubscription = EventSystem::getInstance().subscribe<LevelCompletedEvent>(
         [this](const LevelCompletedEvent& event) {
             if (m_levelCompleteHandler) {
                 m_levelCompleteHandler(event);
@@ -66,7 +68,7 @@ void GameEventCoordinator::setupDefaultHandlers() {
         }
     );
 
-    EventSystem::getInstance().subscribe<PlayerDiedEvent>(
+    m_playerDeathSubscription = EventSystem::getInstance().subscribe<PlayerDiedEvent>(
         [this](const PlayerDiedEvent& event) {
             if (m_playerDeathHandler) {
                 m_playerDeathHandler(event);
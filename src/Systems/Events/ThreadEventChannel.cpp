@@ -0,0 +1,116 @@
+#include "ThreadEventChannel.h"
+#include <iostream>
+
+//-------------------------------------------------------------------------------------
+ThreadEventChannel::ThreadEventChannel(std::size_t capacity, Overflow overflow, Clock::duration lateThreshold)
+    : m_overflow(overflow), m_lateThreshold(lateThreshold) {
+    std::size_t size = 2;
+    while (size < capacity) {
+        size <<= 1;
+    }
+    m_mask = size - 1;
+    m_slots = std::make_unique<Slot[]>(size);
+
+    // Slot i is free for the producer that claims position i
+    for (std::size_t i = 0; i < size; ++i) {
+        m_slots[i].sequence.store(i, std::memory_order_relaxed);
+    }
+}
+//-------------------------------------------------------------------------------------
+ThreadEventChannel& ThreadEventChannel::getInstance() {
+    static ThreadEventChannel* instance = new ThreadEventChannel();
+    return *instance;
+}
+//-------------------------------------------------------------------------------------
+bool ThreadEventChannel::push(Delivery&& deliver) {
+    // The consumer cannot wait on itself
+    const bool mayBlock = m_overflow == Overflow::Block && m_consumer.load() != std::this_thread::get_id();
+    bool waited = false;
+
+    Slot* slot = nullptr;
+    std::size_t pos = m_enqueuePos.load(std::memory_order_relaxed);
+    while (true) {
+        slot = &m_slots[pos & m_mask];
+        std::size_t sequence = slot->sequence.load(std::memory_order_acquire);
+        auto diff = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(pos);
+
+        if (diff == 0) {
+            // Slot is free at our position; claim it
+            if (m_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        }
+        else if (diff < 0) {
+            // Slot still holds an event from the previous lap: the ring is full
+            if (!mayBlock) {
+                m_dropped.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+            waited = true;
+            std::this_thread::yield();
+            pos = m_enqueuePos.load(std::memory_order_relaxed);
+        }
+        else {
+            // Another producer claimed this position first
+            pos = m_enqueuePos.load(std::memory_order_relaxed);
+        }
+    }
+
+    slot->deliver = std::move(deliver);
+    slot->postedAt = Clock::now();
+    slot->sequence.store(pos + 1, std::memory_order_release);
+
+    m_posted.fetch_add(1, std::memory_order_relaxed);
+    if (waited) {
+        m_blocked.fetch_add(1, std::memory_order_relaxed);
+    }
+    return true;
+}
+//-------------------------------------------------------------------------------------
+std::size_t ThreadEventChannel::drain(EventSystem& events) {
+    m_consumer.store(std::this_thread::get_id());
+
+    const Clock::time_point now = Clock::now();
+    const std::size_t limit = getCapacity();
+    std::size_t count = 0;
+    std::uint64_t late = 0;
+
+    while (count < limit) {
+        Slot& slot = m_slots[m_dequeuePos & m_mask];
+        if (slot.sequence.load(std::memory_order_acquire) != m_dequeuePos + 1) {
+            break;  // Empty, or the producer has not finished writing
+        }
+
+        // Take the event out and free the slot before running handlers,
+        // so producers are not held up by slow subscribers
+        Delivery deliver = std::move(slot.deliver);
+        if (now - slot.postedAt > m_lateThreshold) {
+            ++late;
+        }
+        slot.sequence.store(m_dequeuePos + m_mask + 1, std::memory_order_release);
+        ++m_dequeuePos;
+
+        try {
+            deliver(events);
+        }
+        catch (const std::exception& e) {
+            std::cerr << "[ThreadEventChannel] Handler error: " << e.what() << std::endl;
+        }
+        ++count;
+    }
+
+    m_delivered.fetch_add(count, std::memory_order_relaxed);
+    m_late.fetch_add(late, std::memory_order_relaxed);
+    return count;
+}
+//-------------------------------------------------------------------------------------
+ThreadEventChannel::Stats ThreadEventChannel::getStats() const {
+    Stats stats;
+    stats.posted = m_posted.load(std::memory_order_relaxed);
+    stats.delivered = m_delivered.load(std::memory_order_relaxed);
+    stats.dropped = m_dropped.load(std::memory_order_relaxed);
+    stats.blocked = m_blocked.load(std::memory_order_relaxed);
+    stats.late = m_late.load(std::memory_order_relaxed);
+    return stats;
+}
+//-------------------------------------------------------------------------------------
@@ -1,4 +1,5 @@
 #include "EntityManager.h"
+#include <algorithm>
 
 //-------------------------------------------------------------------------------------
 EntityManager::EntityManager() = default;
@@ -6,7 +7,12 @@ EntityManager::EntityManager() = default;
 EntityManager::~EntityManager() = default;
 //-------------------------------------------------------------------------------------
 void EntityManager::destroyEntity(IdType id) {
-    m_entities.erase(id);
+    auto it = m_entities.find(id);
+    if (it == m_entities.end()) {
+        return;
+    }
+    notifyRemoved(it->second.get());
+    m_entities.erase(it);
 }
 //-------------------------------------------------------------------------------------
 Entity* EntityManager::getEntity(IdType id) {
@@ -27,6 +33,9 @@ void EntityManager::updateAll(float dt) {
 }
 //-------------------------------------------------------------------------------------
 void EntityManager::clear() {
+    for (auto& [id, entity] : m_entities) {
+        notifyRemoved(entity.get());
+    }
     m_entities.clear();
 }
 //-------------------------------------------------------------------------------------
@@ -48,13 +57,20 @@ void EntityManager::addEntity(std::unique_ptr<Entity> entity)
 {
     if (entity) {
         IdType id = entity->getId();
+        auto existing = m_entities.find(id);
+        if (existing != m_entities.end()) {
+            notifyRemoved(existing->second.get());
+        }
+        Entity* added = entity.get();
         m_entities[id] = std::move(entity);
+        notifyAdded(added);
     }
 }
 //-------------------------------------------------------------------------------------
 void EntityManager::removeInactiveEntities() {
     for (auto it = m_entities.begin(); it != m_entities.end(); ) {
         if (!it->second->isActive()) {
+            notifyRemoved(it->second.get());
             it = m_entities.erase(it);
         }
         else {
@@ -66,4 +82,26 @@ void EntityManager::removeInactiveEntities() {
 EntityManager::IdType EntityManager::generateId() {
     return m_nextId++;
 }
+//-------------------------------------------------------------------------------------
+void EntityManager::addListener(Listener* listener) {
+    if (listener && std::find(m_listeners.begin(), m_listeners.end(), listener) == m_listeners.end()) {
+        m_listeners.push_back(listener);
+    }
+}
+//-------------------------------------------------------------------------------------
+void EntityManager::removeListener(Listener* listener) {
+    m_listeners.erase(std::remove(m_listeners.begin(), m_listeners.end(), listener), m_listeners.end());
+}
+//-------------------------------------------------------------------------------------
+void EntityManager::notifyAdded(Entity* entity) {
+    for (auto* listener : m_listeners) {
+        listener->onEntityAdded(entity);
+    }
+}
+//-------------------------------------------------------------------------------------
+void EntityManager::notifyRemoved(Entity* entity) {
+    for (auto* listener : m_listeners) {
+        listener->onEntityRemoved(entity);
+    }
+}
 //-------------------------------------------------------------------------------------
\ No newline at end of file
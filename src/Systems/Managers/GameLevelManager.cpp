@@ -3,6 +3,7 @@
 #include "PhysicsManager.h"
 #include "ResourceManager.h"
 #include "GameSession.h"
+#include <chrono>
 #include <iostream>
 #include <PlayerEntity.h>
 #include "EntityFactory.h"
@@ -17,6 +18,7 @@ void GameLevelManager::initialize(EntityManager& entityManager, PhysicsManager&
     m_entityManager = &entityManager;
     m_physicsManager = &physicsManager;
     m_textures = &textures;
+    m_streamer = std::make_unique<LevelStreamer>(entityManager, m_levelLoader);
 
     setupEventHandlers();
 }
@@ -27,6 +29,7 @@ bool GameLevelManager::loadLevel(const std::string& levelPath) {
     }
 
     try {
+        const auto switchStart = std::chrono::steady_clock::now();
         m_transitionPending = false;
         m_transitionTimer = 0.0f;
         m_needLevelSwitch = false;
@@ -34,31 +37,29 @@ bool GameLevelManager::loadLevel(const std::string& levelPath) {
         if (g_currentSession) {
             g_currentSession->invalidateCachedPlayer();
         }
+        // Stop streaming first so clearing the old level is not recorded as removals
+        m_streamer->stop();
         m_entityManager->clear();
-        TextureManager& textureManager = *m_textures;
-        bool success = m_levelLoader.loadFromFile(levelPath, *m_entityManager, m_physicsManager->getWorld(), textureManager);
+
+        bool success = false;
+        if (m_streamingEnabled) {
+            // Only the spawn list is read here, in the background; chunks come in with the camera
+            m_streamer->start(levelPath);
+            success = true;
+        }
+        else {
+            TextureManager& textureManager = *m_textures;
+            success = m_levelLoader.loadFromFile(levelPath, *m_entityManager, m_physicsManager->getWorld(), textureManager);
+        }
 
         if (success) {
-            bool playerFound = false;
-            for (auto* entity : m_entityManager->getAllEntities()) {
-                if (auto* player = dynamic_cast<PlayerEntity*>(entity)) {
-                    playerFound = true;
-                    break;
-                }
-            }
-            if (!playerFound) {
-                try {
-                    auto playerEntity = EntityFactory::instance().create("Player", 200.0f, 400.0f);
-                    if (playerEntity) {
-                        m_entityManager->addEntity(std::move(playerEntity));
-                    }
-                }
-                catch (const std::exception& e) {
-					std::cerr << "[ERROR] Failed to create default player entity: " << e.what() << std::endl;
-                }
-            }
+            ensurePlayer();
         }
 
+        m_switchMs = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - switchStart).count();
+        if (success && !m_streamingEnabled) {
+            std::cout << "[GameLevelManager] Level switch stalled " << m_switchMs << " ms" << std::endl;
+        }
         return success;
     }
     catch (const std::exception& e) {
@@ -104,11 +105,61 @@ bool GameLevelManager::loadNextLevel() {
     return false;
 }
 //-------------------------------------------------------------------------------------
+void GameLevelManager::ensurePlayer() {
+    bool playerFound = false;
+    for (auto* entity : m_entityManager->getAllEntities()) {
+        if (dynamic_cast<PlayerEntity*>(entity)) {
+            playerFound = true;
+            break;
+        }
+    }
+    if (!playerFound) {
+        try {
+            auto playerEntity = EntityFactory::instance().create("Player", 200.0f, 400.0f);
+            if (playerEntity) {
+                m_entityManager->addEntity(std::move(playerEntity));
+            }
+        }
+        catch (const std::exception& e) {
+			std::cerr << "[ERROR] Failed to create default player entity: " << e.what() << std::endl;
+        }
+    }
+}
+//-------------------------------------------------------------------------------------
 bool GameLevelManager::reloadCurrentLevel() {
     std::string currentLevel = m_levelManager.getCurrentLevelPath();
+
+    // The streamer still holds this level's spawn list: restore from it instead of the file
+    if (m_streamingEnabled && m_streamer && m_streamer->isActive() && m_streamer->getPath() == currentLevel) {
+        return restartLevel();
+    }
     return loadLevel(currentLevel);
 }
 //-------------------------------------------------------------------------------------
+bool GameLevelManager::restartLevel() {
+    try {
+        const auto restartStart = std::chrono::steady_clock::now();
+        m_transitionPending = false;
+        m_transitionTimer = 0.0f;
+        m_needLevelSwitch = false;
+
+        if (g_currentSession) {
+            g_currentSession->invalidateCachedPlayer();
+        }
+        if (!m_streamer->restart()) {
+            return loadLevel(m_levelManager.getCurrentLevelPath());
+        }
+        ensurePlayer();
+
+        m_switchMs = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - restartStart).count();
+        return true;
+    }
+    catch (const std::exception& e) {
+		std::cerr << "[ERROR] Failed to restart level: " << e.what() << std::endl;
+        return false;
+    }
+}
+//-------------------------------------------------------------------------------------
 const std::string& GameLevelManager::getCurrentLevelPath() const {
     return m_levelManager.getCurrentLevelPath();
 }
@@ -125,6 +176,50 @@ std::size_t GameLevelManager::getLevelCount() const {
     return m_levelManager.getLevelCount();
 }
 //-------------------------------------------------------------------------------------
+void GameLevelManager::updateStreaming(const sf::View& camera) {
+    if (!m_streamer || !m_streamingEnabled) {
+        return;
+    }
+    m_streamer->update(camera);
+
+    // Report the whole hitch of a level switch once its first chunks exist
+    LevelStreamer::StartupStats startup;
+    if (!m_streamer->takeStartupStats(startup)) {
+        return;
+    }
+
+    // The spawn list is known now; parse the level the player can reach next while this one plays
+    if (!startup.restarted) {
+        preloadLevel(getUpcomingLevelPath());
+    }
+    if (startup.restarted) {
+        std::cout << "[GameLevelManager] Level restart took "
+                  << m_switchMs + startup.instantiateMs << " ms from the snapshot (reset "
+                  << m_switchMs << ", first chunks " << startup.instantiateMs << ")" << std::endl;
+    }
+    else {
+        std::cout << "[GameLevelManager] Level switch stalled "
+                  << m_switchMs + startup.parseWaitMs + startup.instantiateMs << " ms (loadLevel "
+                  << m_switchMs << ", parse wait " << startup.parseWaitMs << ", first chunks "
+                  << startup.instantiateMs << (startup.preloaded ? ", preloaded" : "") << ")" << std::endl;
+    }
+}
+//-------------------------------------------------------------------------------------
+std::string GameLevelManager::getUpcomingLevelPath() const {
+    // Wells lead to their default target; level files cannot choose another
+    const std::string& current = m_streamer->getPath();
+    if (current != ResourcePaths::DARK_LEVEL && m_streamer->hasSpawnType('W')) {
+        return ResourcePaths::DARK_LEVEL;
+    }
+    return m_levelManager.getNextLevelPath();
+}
+//-------------------------------------------------------------------------------------
+void GameLevelManager::preloadLevel(const std::string& levelPath) {
+    if (m_streamer && !levelPath.empty()) {
+        m_streamer->preload(levelPath);
+    }
+}
+//-------------------------------------------------------------------------------------
 void GameLevelManager::update(float deltaTime) {
     if (m_needLevelSwitch) {
         m_needLevelSwitch = false;
@@ -157,29 +252,49 @@ void GameLevelManager::update(float deltaTime) {
 //-------------------------------------------------------------------------------------
 void GameLevelManager::setupEventHandlers() {
     try {
-        EventSystem::getInstance().subscribe<FlagReachedEvent>(
+        m_subscriptions.clear();
+        m_subscriptions.push_back(EventSystem::getInstance().subscribe<FlagReachedEvent>(
             [this](const FlagReachedEvent& event) {
                 this->onFlagReached(event);
             }
-        );
+        ));
 
-        EventSystem::getInstance().subscribe<LevelTransitionEvent>(
+        m_subscriptions.push_back(EventSystem::getInstance().subscribe<LevelTransitionEvent>(
             [this](const LevelTransitionEvent& event) {
                 this->onLevelTransition(event);
             }
-        );
+        ));
 
-        EventSystem::getInstance().subscribe<WellEnteredEvent>(
+        m_subscriptions.push_back(EventSystem::getInstance().subscribe<WellEnteredEvent>(
             [this](const WellEnteredEvent& event) {
                 this->onWellEntered(event);
             }
-        );
+        ));
+
+        m_subscriptions.push_back(EventSystem::getInstance().subscribe<LevelParsedEvent>(
+            [this](const LevelParsedEvent& event) {
+                this->onLevelParsed(event);
+            }
+        ));
     }
     catch (const std::exception& e) {
 		std::cerr << "[ERROR] Failed to set up event handlers: " << e.what() << std::endl;
     }
 }
 //-------------------------------------------------------------------------------------
+void GameLevelManager::onLevelParsed(const LevelParsedEvent& event) {
+    // The streamer reports the level it is starting; only preloads are news here
+    if (!m_streamer || event.levelPath == m_streamer->getPath()) {
+        return;
+    }
+    if (!event.ok) {
+        std::cerr << "[GameLevelManager] Could not preload " << event.levelPath << std::endl;
+        return;
+    }
+    std::cout << "[GameLevelManager] Preloaded " << event.levelPath << ": " << event.spawnCount
+              << " spawns in " << event.parseMs << " ms" << std::endl;
+}
+//-------------------------------------------------------------------------------------
 void GameLevelManager::onFlagReached(const FlagReachedEvent&) {
     m_transitionPending = true;
     m_transitionTimer = 0.0f;
@@ -45,6 +45,10 @@ bool LevelManager::hasNextLevel() const {
     return m_currentIndex + 1 < m_levels.size();
 }
 //-------------------------------------------------------------------------------------
+std::string LevelManager::getNextLevelPath() const {
+    return hasNextLevel() ? m_levels[m_currentIndex + 1] : std::string();
+}
+//-------------------------------------------------------------------------------------
 void LevelManager::resetToFirstLevel() {
     m_currentIndex = 0;
 }
@@ -0,0 +1,375 @@
+#include "LevelStreamer.h"
+#include "LevelLoader.h"
+#include "Constants.h"
+#include "Transform.h"
+#include "GameEvents.h"
+#include "ThreadEventChannel.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+
+//-------------------------------------------------------------------------------------
+LevelStreamer::LevelStreamer(EntityManager& entities, const LevelLoader& loader)
+    : m_entities(entities), m_loader(loader) {
+    m_entities.addListener(this);
+}
+//-------------------------------------------------------------------------------------
+LevelStreamer::~LevelStreamer() {
+    stop();
+    m_preload = {};
+    m_retired.clear();      // Future destructors wait for the parse threads
+    m_entities.removeListener(this);
+}
+//-------------------------------------------------------------------------------------
+void LevelStreamer::start(const std::string& path) {
+    stop();
+    m_path = path;
+    m_active = true;
+    m_startup = StartupStats();
+    m_startupPending = true;
+
+    if (m_preload.valid() && m_preloadPath == path) {
+        m_parse = std::move(m_preload);
+        m_preloadPath.clear();
+        m_startup.preloaded = true;
+    }
+    else {
+        m_parse = parseAsync(path);
+    }
+}
+//-------------------------------------------------------------------------------------
+bool LevelStreamer::restart() {
+    if (!m_active) {
+        return false;
+    }
+
+    // Clearing the old run is not a removal to remember
+    m_active = false;
+    m_entities.clear();
+    m_active = true;
+
+    for (Chunk& chunk : m_chunks) {
+        chunk.loaded = false;
+        std::vector<std::uint64_t>().swap(chunk.removed);
+        std::vector<Relocation>().swap(chunk.relocated);
+        std::vector<Entity::IdType>().swap(chunk.entities);
+    }
+    m_loaded.clear();
+    m_liveSpawns.clear();
+
+    m_startup = StartupStats();
+    m_startup.restarted = true;
+    m_startupPending = true;
+    m_startupReady = false;
+    return true;
+}
+//-------------------------------------------------------------------------------------
+void LevelStreamer::preload(const std::string& path) {
+    if (path.empty() || (m_preload.valid() && m_preloadPath == path)) {
+        return;
+    }
+    if (m_preload.valid()) {
+        retire(std::move(m_preload));
+    }
+    m_preloadPath = path;
+    m_preload = parseAsync(path);
+    std::cout << "[LevelStreamer] Preloading " << path << std::endl;
+}
+//-------------------------------------------------------------------------------------
+std::future<LevelStreamer::ParsedLevel> LevelStreamer::parseAsync(const std::string& path) const {
+    const LevelLoader* loader = &m_loader;
+    return std::async(std::launch::async, [loader, path]() {
+        auto started = std::chrono::steady_clock::now();
+        ParsedLevel parsed;
+        parsed.ok = loader->readSpawns(path, parsed.spawns);
+        float parseMs = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - started).count();
+
+        // EventSystem belongs to the game thread; it sees this at the next drain
+        ThreadEventChannel::getInstance().post(LevelParsedEvent(path, parsed.spawns.size(), parseMs, parsed.ok));
+        return parsed;
+    });
+}
+//-------------------------------------------------------------------------------------
+void LevelStreamer::retire(std::future<ParsedLevel> parse) {
+    // Dropping an std::async future blocks until its thread ends, so finished
+    // ones are released here and the rest wait for a later call
+    auto finished = [](const std::future<ParsedLevel>& pending) {
+        return pending.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+    };
+    m_retired.erase(std::remove_if(m_retired.begin(), m_retired.end(), finished), m_retired.end());
+    if (parse.valid() && !finished(parse)) {
+        m_retired.push_back(std::move(parse));
+    }
+}
+//-------------------------------------------------------------------------------------
+bool LevelStreamer::hasSpawnType(char type) const {
+    return std::any_of(m_spawns.begin(), m_spawns.end(),
+        [type](const CompiledLevel::Spawn& spawn) { return spawn.type == type; });
+}
+//-------------------------------------------------------------------------------------
+bool LevelStreamer::takeStartupStats(StartupStats& stats) {
+    if (!m_startupReady) {
+        return false;
+    }
+    stats = m_startup;
+    m_startupReady = false;
+    return true;
+}
+//-------------------------------------------------------------------------------------
+void LevelStreamer::stop() {
+    if (m_parse.valid()) {
+        retire(std::move(m_parse));
+        m_parse = {};
+    }
+    m_active = false;
+    m_startupPending = false;
+    m_startupReady = false;
+    m_spawns.clear();
+    m_spawns.shrink_to_fit();
+    m_chunks.clear();
+    m_chunks.shrink_to_fit();
+    m_loaded.clear();
+    m_liveSpawns.clear();
+    m_missingReported.fill(false);
+}
+//-------------------------------------------------------------------------------------
+bool LevelStreamer::takeParsedLevel(bool wait) {
+    if (!m_parse.valid()) {
+        return !m_chunks.empty();
+    }
+    if (!wait && m_parse.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+        return false;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    ParsedLevel parsed = m_parse.get();
+    float waitedMs = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+    m_startup.parseWaitMs = waitedMs;
+
+    if (!parsed.ok) {
+        std::cerr << "[LevelStreamer] Could not read " << m_path << std::endl;
+        m_active = false;
+        return false;
+    }
+
+    m_spawns = std::move(parsed.spawns);
+    const std::uint32_t width = m_spawns.empty() ? 0 : m_spawns.back().column + 1;
+    m_chunks.resize((width + CHUNK_COLUMNS - 1) / CHUNK_COLUMNS);
+
+    // Spawns are sorted by column, so every chunk is one contiguous range
+    std::size_t spawn = 0;
+    for (std::size_t i = 0; i < m_chunks.size(); ++i) {
+        const std::uint32_t endColumn = static_cast<std::uint32_t>((i + 1) * CHUNK_COLUMNS);
+        m_chunks[i].firstSpawn = static_cast<std::uint32_t>(spawn);
+        while (spawn < m_spawns.size() && m_spawns[spawn].column < endColumn) {
+            ++spawn;
+        }
+        m_chunks[i].spawnCount = static_cast<std::uint32_t>(spawn) - m_chunks[i].firstSpawn;
+    }
+
+    std::cout << "[LevelStreamer] " << m_path << ": " << m_spawns.size() << " spawns in "
+        << m_chunks.size() << " chunks";
+    if (waitedMs >= 1.0f) {
+        std::cout << " (waited " << waitedMs << " ms for the parse)";
+    }
+    std::cout << std::endl;
+    return true;
+}
+//-------------------------------------------------------------------------------------
+void LevelStreamer::update(const sf::View& camera) {
+    if (!m_retired.empty()) {
+        retire({});
+    }
+    if (!m_active) {
+        return;
+    }
+    // The first chunks are needed before the player can stand anywhere
+    if (!takeParsedLevel(m_loaded.empty()) || m_chunks.empty()) {
+        return;
+    }
+
+    const float left = camera.getCenter().x - camera.getSize().x / 2.f;
+    const float right = camera.getCenter().x + camera.getSize().x / 2.f;
+    const int chunkWidth = static_cast<int>(CHUNK_COLUMNS);
+    const int lastChunk = static_cast<int>(m_chunks.size()) - 1;
+    const int firstVisible = static_cast<int>(std::floor(left / TILE_SIZE)) / chunkWidth;
+    const int lastVisible = static_cast<int>(std::floor(right / TILE_SIZE)) / chunkWidth;
+
+    // Unload first so a long jump never holds both old and new chunks
+    const int keepFirst = firstVisible - LOAD_BEHIND - UNLOAD_SLACK;
+    const int keepLast = lastVisible + LOAD_AHEAD + UNLOAD_SLACK;
+    for (std::size_t i = 0; i < m_loaded.size();) {
+        const int index = static_cast<int>(m_loaded[i]);
+        if (index < keepFirst || index > keepLast) {
+            unloadChunk(m_loaded[i]);
+            m_loaded[i] = m_loaded.back();
+            m_loaded.pop_back();
+        }
+        else {
+            ++i;
+        }
+    }
+
+    const auto loadStart = std::chrono::steady_clock::now();
+    const int loadFirst = std::max(0, firstVisible - LOAD_BEHIND);
+    const int loadLast = std::min(lastChunk, lastVisible + LOAD_AHEAD);
+    for (int index = loadFirst; index <= loadLast; ++index) {
+        if (!m_chunks[index].loaded) {
+            loadChunk(static_cast<std::size_t>(index));
+            m_loaded.push_back(static_cast<std::size_t>(index));
+        }
+    }
+
+    if (m_startupPending) {
+        m_startup.instantiateMs = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - loadStart).count();
+        m_startupPending = false;
+        m_startupReady = true;
+    }
+}
+//-------------------------------------------------------------------------------------
+void LevelStreamer::loadChunk(std::size_t index) {
+    Chunk& chunk = m_chunks[index];
+    chunk.loaded = true;
+    chunk.entities.clear();
+
+    for (std::uint32_t offset = 0; offset < chunk.spawnCount; ++offset) {
+        if (!isRemoved(chunk, offset)) {
+            const std::uint32_t spawnIndex = chunk.firstSpawn + offset;
+            spawnEntity(index, spawnIndex, m_loader.spawnPosition(m_spawns[spawnIndex]), false);
+        }
+    }
+
+    // Relocated entities are live again; their next unload records them anew
+    std::vector<Relocation> relocated;
+    relocated.swap(chunk.relocated);
+    for (const Relocation& relocation : relocated) {
+        spawnEntity(index, relocation.spawn, relocation.position, true);
+    }
+}
+//-------------------------------------------------------------------------------------
+bool LevelStreamer::spawnEntity(std::size_t index, std::uint32_t spawnIndex, const sf::Vector2f& position, bool relocated) {
+    const EntityFactory::CreatorFunc* creator = creatorFor(m_spawns[spawnIndex].type);
+    if (!creator) {
+        return false;
+    }
+    auto entity = (*creator)(position.x, position.y);
+    if (!entity) {
+        return false;
+    }
+
+    LiveSpawn live;
+    live.spawn = spawnIndex;
+    live.created = position;
+    live.relocated = relocated;
+    const auto* transform = entity->getComponent<Transform>();
+    live.origin = transform ? transform->getPosition() : position;
+
+    const Entity::IdType id = entity->getId();
+    m_chunks[index].entities.push_back(id);
+    m_liveSpawns[id] = live;
+    m_entities.addEntity(std::move(entity));
+    return true;
+}
+//-------------------------------------------------------------------------------------
+std::size_t LevelStreamer::chunkAt(float x) const {
+    const float column = std::floor(x / TILE_SIZE);
+    if (column <= 0.f) {
+        return 0;
+    }
+    const std::size_t chunk = static_cast<std::size_t>(column) / CHUNK_COLUMNS;
+    return std::min(chunk, m_chunks.size() - 1);
+}
+//-------------------------------------------------------------------------------------
+void LevelStreamer::unloadChunk(std::size_t index) {
+    std::vector<Entity::IdType> held;
+    held.swap(m_chunks[index].entities);
+    m_chunks[index].loaded = false;
+
+    m_unloading = true;
+    for (const Entity::IdType id : held) {
+        auto it = m_liveSpawns.find(id);
+        if (it == m_liveSpawns.end()) {
+            continue;   // Removed while the chunk was loaded
+        }
+        const LiveSpawn live = it->second;
+        Entity* entity = m_entities.getEntity(id);
+
+        // Collected or killed but not cleaned up yet: it stays gone
+        if (!entity || !entity->isActive()) {
+            m_liveSpawns.erase(it);
+            markRemoved(live.spawn);
+            m_entities.destroyEntity(id);
+            continue;
+        }
+
+        const auto* transform = entity->getComponent<Transform>();
+        const sf::Vector2f position = transform ? transform->getPosition() : live.origin;
+        const std::size_t target = chunkAt(position.x);
+
+        // Still on screen in a neighbouring chunk: that chunk holds it from now on
+        if (target != index && m_chunks[target].loaded) {
+            m_chunks[target].entities.push_back(id);
+            markRemoved(live.spawn);
+            continue;
+        }
+
+        m_liveSpawns.erase(it);
+        const sf::Vector2f moved = position - live.origin;
+        if (live.relocated || std::abs(moved.x) > TILE_SIZE / 2.f || std::abs(moved.y) > TILE_SIZE / 2.f) {
+            markRemoved(live.spawn);
+            m_chunks[target].relocated.push_back({ live.spawn, live.created + moved });
+        }
+        else {
+            clearRemoved(live.spawn);   // Back where it started; the spawn list recreates it
+        }
+        m_entities.destroyEntity(id);
+    }
+    m_unloading = false;
+}
+//-------------------------------------------------------------------------------------
+void LevelStreamer::onEntityRemoved(Entity* entity) {
+    if (!m_active || m_unloading || !entity) {
+        return;
+    }
+    auto it = m_liveSpawns.find(entity->getId());
+    if (it == m_liveSpawns.end()) {
+        return;
+    }
+
+    // The holding chunk drops the id when it unloads
+    markRemoved(it->second.spawn);
+    m_liveSpawns.erase(it);
+}
+//-------------------------------------------------------------------------------------
+void LevelStreamer::markRemoved(std::uint32_t spawnIndex) {
+    Chunk& chunk = m_chunks[m_spawns[spawnIndex].column / CHUNK_COLUMNS];
+    if (chunk.removed.empty()) {
+        chunk.removed.assign((chunk.spawnCount + 63) / 64, 0);
+    }
+    const std::uint32_t offset = spawnIndex - chunk.firstSpawn;
+    chunk.removed[offset / 64] |= std::uint64_t(1) << (offset % 64);
+}
+//-------------------------------------------------------------------------------------
+void LevelStreamer::clearRemoved(std::uint32_t spawnIndex) {
+    Chunk& chunk = m_chunks[m_spawns[spawnIndex].column / CHUNK_COLUMNS];
+    if (!chunk.removed.empty()) {
+        const std::uint32_t offset = spawnIndex - chunk.firstSpawn;
+        chunk.removed[offset / 64] &= ~(std::uint64_t(1) << (offset % 64));
+    }
+}
+//-------------------------------------------------------------------------------------
+bool LevelStreamer::isRemoved(const Chunk& chunk, std::uint32_t offset) const {
+    return !chunk.removed.empty() && (chunk.removed[offset / 64] >> (offset % 64)) & 1u;
+}
+//-------------------------------------------------------------------------------------
+const EntityFactory::CreatorFunc* LevelStreamer::creatorFor(char type) {
+    const EntityFactory::CreatorFunc* creator = EntityFactory::instance().findCreator(type);
+    bool& reported = m_missingReported[static_cast<unsigned char>(type)];
+    if (!creator && !reported) {
+        std::cerr << "Error: No creator registered for type: " << type << std::endl;
+        reported = true;
+    }
+    return creator;
+}
+//-------------------------------------------------------------------------------------
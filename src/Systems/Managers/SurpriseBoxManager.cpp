@@ -21,10 +21,12 @@ SurpriseBoxManager::SurpriseBoxManager(TextureManager& textures, sf::RenderWindo
     // Create surprise box screen
     m_surpriseScreen = std::make_unique<SurpriseBoxScreen>(window, textures);
 
-    // Subscribe to coin collected events
-    EventSystem::getInstance().subscribe<CoinCollectedEvent>(
-        [this](const CoinCollectedEvent&) {
-            this->onCoinCollected();
+    // Coins arrive as one batch per frame, after collision handling
+    m_coinSubscription = EventSystem::getInstance().subscribeBatch<CoinCollectedEvent>(
+        [this](std::span<const CoinCollectedEvent> coins) {
+            for (std::size_t i = 0; i < coins.size(); ++i) {
+                this->onCoinCollected();
+            }
         }
     );
 }
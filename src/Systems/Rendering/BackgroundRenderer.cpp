@@ -1,33 +1,46 @@
 #include "BackgroundRenderer.h"
 #include "Constants.h"
-#include <stdexcept>
+#include <cmath>
 
 //-------------------------------------------------------------------------------------
-BackgroundRenderer::BackgroundRenderer(TextureManager&) {
-    if (!m_backgroundTexture.loadFromFile("backGroundGame.jpeg")) {
-        throw std::runtime_error("Failed to load background image.");
-    }
-    setupBackground();
+BackgroundRenderer::BackgroundRenderer(TextureManager& textures)
+    : m_textures(textures) {
+    // Loaded through the shared cache, so it is decoded once per run
+    addLayer("backGroundGame.jpeg", 1.0f);
 }
 //-------------------------------------------------------------------------------------
-void BackgroundRenderer::setupBackground() {
-    m_backgroundSprite.setTexture(m_backgroundTexture);
-    float scaleY = WINDOW_HEIGHT / m_backgroundTexture.getSize().y;
-    m_backgroundSprite.setScale(scaleY, scaleY);
+void BackgroundRenderer::addLayer(const std::string& filename, float parallax) {
+    sf::Texture& texture = m_textures.getResource(filename);
+    texture.setRepeated(true);
+
+    float scale = WINDOW_HEIGHT / static_cast<float>(texture.getSize().y);
+    m_layers.push_back({ &texture, scale, parallax });
 }
 //-------------------------------------------------------------------------------------
-void BackgroundRenderer::render(sf::RenderWindow& window, const sf::View& camera) const {
-    float bgWidth = m_backgroundTexture.getSize().x * m_backgroundSprite.getScale().x;
+void BackgroundRenderer::render(RenderCommandList& commands, const sf::View& camera) const {
     float camLeft = camera.getCenter().x - camera.getSize().x / 2.f;
     float camRight = camLeft + camera.getSize().x;
 
-    int startTile = static_cast<int>(camLeft / bgWidth) - 1;
-    int endTile = static_cast<int>(camRight / bgWidth) + 1;
+    for (const auto& layer : m_layers) {
+        sf::Vector2u size = layer.texture->getSize();
+
+        // Horizontal texture offset of the camera's left edge, wrapped to one
+        // image width so texture coordinates stay small far into the level
+        float offset = std::fmod(camLeft * layer.parallax / layer.scale, static_cast<float>(size.x));
+        if (offset < 0.f) {
+            offset += static_cast<float>(size.x);
+        }
+        float left = offset;
+        float right = offset + (camRight - camLeft) / layer.scale;
+        float bottom = static_cast<float>(size.y);
 
-    for (int i = startTile; i <= endTile; ++i) {
-        sf::Sprite repeatedBg = m_backgroundSprite;
-        repeatedBg.setPosition(i * bgWidth, 0.f);
-        window.draw(repeatedBg);
+        sf::Vertex quad[4] = {
+            sf::Vertex({ camLeft, 0.f }, { left, 0.f }),
+            sf::Vertex({ camRight, 0.f }, { right, 0.f }),
+            sf::Vertex({ camRight, WINDOW_HEIGHT }, { right, bottom }),
+            sf::Vertex({ camLeft, WINDOW_HEIGHT }, { left, bottom })
+        };
+        commands.draw(quad, 4, sf::Quads, sf::RenderStates(layer.texture));
     }
 }
 //-------------------------------------------------------------------------------------
\ No newline at end of file
@@ -9,36 +9,35 @@
 #include <PhysicsComponent.h>
 #include <numeric>
 #include <SmartEnemyEntity.h>
+#include "JobSystem.h"
+#include "CollisionComponent.h"
+#include "RenderComponent.h"
 
 #ifndef M_PI
 #define M_PI 3.14159265358979323846
 #endif
 //-------------------------------------------------------------------------------------
-DarkLevelSystem::DarkLevelSystem() {
+DarkLevelSystem::DarkLevelSystem()
+    : m_obstacles(TILE_SIZE * 2.0f) {
     m_lightCircle.setRadius(m_playerLightRadius);
     m_lightCircle.setOrigin(m_playerLightRadius, m_playerLightRadius);
     m_lightCircle.setFillColor(sf::Color::Transparent);
     m_lightCircle.setOutlineThickness(0);
 }
 //-------------------------------------------------------------------------------------
-DarkLevelSystem::~DarkLevelSystem() = default;
+DarkLevelSystem::~DarkLevelSystem() {
+    if (m_source) {
+        m_source->removeListener(this);
+    }
+}
 //-------------------------------------------------------------------------------------
 void DarkLevelSystem::initialize(sf::RenderWindow& window) {
     sf::Vector2u windowSize = window.getSize();
+    m_windowSize = windowSize;
 
-    // Create all necessary render textures
-    m_lightTexture = std::make_unique<sf::RenderTexture>();
-    m_darknessTexture = std::make_unique<sf::RenderTexture>();
-    m_flashlightTexture = std::make_unique<sf::RenderTexture>();
-    m_maskTexture = std::make_unique<sf::RenderTexture>();
-    m_shadowMapTexture = std::make_unique<sf::RenderTexture>();
-
-    if (!m_lightTexture->create(windowSize.x, windowSize.y) ||
-        !m_darknessTexture->create(windowSize.x, windowSize.y) ||
-        !m_flashlightTexture->create(windowSize.x, windowSize.y) ||
-        !m_shadowMapTexture->create(windowSize.x, windowSize.y) ||
-        !m_maskTexture->create(windowSize.x, windowSize.y)) {
-        std::cerr << "[DarkLevelSystem] Failed to create render textures" << std::endl;
+    // All light is accumulated into one reduced-resolution lightmap
+    applyQualityLevel();
+    if (!createLightmap()) {
         return;
     }
 
@@ -69,9 +68,51 @@ void DarkLevelSystem::initialize(sf::RenderWindow& window) {
     }
 }
 //-------------------------------------------------------------------------------------
+bool DarkLevelSystem::createLightmap() {
+    unsigned int width = std::max(1u, m_windowSize.x / m_lightmapScale);
+    unsigned int height = std::max(1u, m_windowSize.y / m_lightmapScale);
+
+    m_lightmap = std::make_shared<sf::RenderTexture>();
+    if (!m_lightmap->create(width, height)) {
+        std::cerr << "[DarkLevelSystem] Failed to create " << width << "x" << height << " lightmap" << std::endl;
+        m_lightmap.reset();
+        return false;
+    }
+
+    // Bilinear filtering hides the lower resolution when stretched over the window
+    m_lightmap->setSmooth(true);
+    return true;
+}
+//-------------------------------------------------------------------------------------
+void DarkLevelSystem::setLightmapScale(unsigned int divisor) {
+    divisor = std::clamp(divisor, 1u, 8u);
+    if (divisor == m_lightmapScale) {
+        return;
+    }
+    m_lightmapScale = divisor;
+    if (m_lightmap) {
+        createLightmap();
+    }
+}
+//-------------------------------------------------------------------------------------
+void DarkLevelSystem::applyQualityLevel() {
+    const auto& settings = m_quality.getSettings();
+    m_coneSegments = settings.rayCount;
+    m_arcSegments = settings.arcSegments;
+    setLightmapScale(settings.lightmapScale);
+
+    // Static light meshes were built with the old arc resolution
+    for (auto& light : m_lightSources) {
+        light.workspace.visibility.setArcSegments(m_arcSegments);
+        light.dirty = true;
+    }
+}
+//-------------------------------------------------------------------------------------
 void DarkLevelSystem::update(float dt, PlayerEntity* player) {
     if (!m_enabled) return;
 
+    syncEntityObstacles();
+
     updatePlayerLight(player);  
 
     // Update animation timers
@@ -104,24 +145,25 @@ void DarkLevelSystem::updatePlayerLight(PlayerEntity* player) {
     }
 }
 //-------------------------------------------------------------------------------------
-void DarkLevelSystem::render(sf::RenderWindow& window) {
-    if (!m_enabled) {
+void DarkLevelSystem::render(RenderCommandList& commands, const sf::View& view) {
+    if (!m_enabled || !m_lightmap) {
         return;
     }
 
-    sf::View currentView = window.getView();
-    sf::Vector2f viewCenter = currentView.getCenter();
-    sf::Vector2f viewSize = currentView.getSize();
+    sf::Vector2f viewCenter = view.getCenter();
+    sf::Vector2f viewSize = view.getSize();
 
     sf::RectangleShape darknessOverlay;
     darknessOverlay.setSize(viewSize);
     darknessOverlay.setPosition(viewCenter - viewSize / 2.0f);
     darknessOverlay.setFillColor(sf::Color(0, 0, 0, static_cast<sf::Uint8>(255 * m_darknessLevel)));
 
-    window.draw(darknessOverlay); 
+    commands.draw(darknessOverlay);
+
+    m_lightingClock.restart();
 
-    m_flashlightTexture->setView(currentView);
-    m_flashlightTexture->clear(sf::Color::Transparent);
+    // Same world view as the window, rasterized into fewer pixels
+    commands.beginOffscreen(m_lightmap, view, sf::Color::Transparent);
 
     sf::CircleShape playerLight;
     float lightRadius = 50.0f;
@@ -130,221 +172,63 @@ void DarkLevelSystem::render(sf::RenderWindow& window) {
     playerLight.setPosition(m_playerLightPos);
     playerLight.setFillColor(sf::Color(255, 255, 220, 200));  
 
-    m_flashlightTexture->draw(playerLight, sf::BlendAdd);
+    commands.draw(playerLight, sf::BlendAdd);
 
-    if (m_flashlightOn && m_playerLightPos.x != 0 && m_playerLightPos.y != 0) {
-        drawFlashlightCone(m_flashlightIntensity);
+    // Meshes are generated in parallel; this thread only records them.
+    // Ambient lights are off by default: the level has always shown only the player's lights
+    buildLightMeshes();
+    if (m_ambientLightsVisible) {
+        renderLightSources(commands);
+    }
+    if (m_flashlightCone.getVertexCount() > 0) {
+        commands.draw(m_flashlightCone);
     }
 
-    m_flashlightTexture->display();
+    commands.endOffscreen();
 
-    sf::Sprite flashlightSprite(m_flashlightTexture->getTexture());
-    flashlightSprite.setPosition(window.mapPixelToCoords({ 0, 0 }));
-    flashlightSprite.setOrigin(0, 0);
-    window.draw(flashlightSprite, sf::RenderStates(sf::BlendAdd));
-}
-//-------------------------------------------------------------------------------------
-void DarkLevelSystem::renderShadowMap(const sf::Vector2f& lightPos, float radius, sf::RenderTexture& target) {
-    // Cast rays in all directions from the light source
-    std::vector<Ray> rays;
-    castRays(lightPos, rays, radius);
-    
-    // Create a vertex array to draw the light with shadows and better color preservation
-    sf::VertexArray shadowMesh(sf::TriangleFan);
-    
-    // Start at the light source position with brighter center
-    shadowMesh.append(sf::Vertex(lightPos, sf::Color(255, 255, 255, 255)));
-    
-    // Add vertices for each ray's endpoint with better light distribution
-    for (const auto& ray : rays) {
-        // Calculate distance-based alpha for realistic light falloff
-        float distanceFactor = 1.0f - (ray.distance / radius);
-        distanceFactor = std::max(0.0f, distanceFactor);
-        
-        // Use brighter, more natural light color that preserves object colors
-        sf::Uint8 alpha = static_cast<sf::Uint8>(150 * distanceFactor);
-        sf::Color rayColor = sf::Color(255, 255, 240, alpha); // Warm white light
-        
-        shadowMesh.append(sf::Vertex(ray.endPoint, rayColor));
-    }
-    
-    // Close the shape by adding the first ray endpoint again
-    if (!rays.empty()) {
-        float distanceFactor = 1.0f - (rays[0].distance / radius);
-        distanceFactor = std::max(0.0f, distanceFactor);
-        sf::Uint8 alpha = static_cast<sf::Uint8>(150 * distanceFactor);
-        shadowMesh.append(sf::Vertex(rays[0].endPoint, sf::Color(255, 255, 240, alpha)));
+    // Upsample the lightmap over the visible area
+    sf::Sprite lightmapSprite(m_lightmap->getTexture());
+    sf::Vector2u lightmapSize = m_lightmap->getSize();
+    lightmapSprite.setPosition(viewCenter - viewSize / 2.0f);
+    lightmapSprite.setScale(viewSize.x / static_cast<float>(lightmapSize.x),
+                            viewSize.y / static_cast<float>(lightmapSize.y));
+    commands.draw(lightmapSprite, sf::RenderStates(sf::BlendAdd));
+
+    // Settings from a level change take effect on the next frame
+    if (m_quality.update(m_lightingClock.getElapsedTime().asSeconds() * 1000.0f)) {
+        applyQualityLevel();
     }
-    
-    // Draw the shadow mesh with additive blending for better color mixing
-    target.draw(shadowMesh, sf::BlendAdd);
-    
-    // Add a secondary light layer for better object illumination
-    sf::CircleShape lightGlow(radius * 0.7f);
-    lightGlow.setOrigin(radius * 0.7f, radius * 0.7f);
-    lightGlow.setPosition(lightPos);
-    lightGlow.setFillColor(sf::Color(255, 255, 240, 60)); // Subtle glow
-    target.draw(lightGlow, sf::BlendAdd);
 }
 //-------------------------------------------------------------------------------------
-void DarkLevelSystem::castRays(const sf::Vector2f& origin, std::vector<Ray>& rays, float maxDistance) {
-    // Generate rays in all directions
+void DarkLevelSystem::castRays(const sf::Vector2f& origin, float maxDistance, ShadowWorkspace& workspace) const {
+    std::vector<Ray>& rays = workspace.rays;
     rays.clear();
-    
-    // Number of rays to cast (more = smoother shadows but lower performance)
-    const int rayCount = m_rayCount;
-    
-    // Cast rays in a full circle
-    for (int i = 0; i < rayCount; i++) {
-        float angle = static_cast<float>(i) * 2.0f * static_cast<float>(M_PI) / rayCount;
+
+    // Exact visibility polygon: rays only toward obstacle corners, resolved in angle order
+    workspace.visibility.begin(origin, maxDistance);
+    workspace.nearby.clear();
+    m_obstacles.queryRadius(origin, maxDistance, workspace.nearby);
+    for (ObstacleGrid::Id id : workspace.nearby) {
+        workspace.visibility.addObstacle(m_obstacles.getBounds(id));
+    }
+
+    const auto& vertices = workspace.visibility.build();
+    rays.reserve(vertices.size());
+    for (const auto& vertex : vertices) {
         Ray ray;
         ray.origin = origin;
-        ray.direction = sf::Vector2f(std::cos(angle), std::sin(angle));
-        ray.distance = maxDistance; // Default max distance
-        ray.endPoint = origin + ray.direction * maxDistance;
-        
-        // Check for intersections with obstacles
-        float minDist = maxDistance;
-        sf::Vector2f closestPoint;
-        bool hitObstacle = false;
-        
-        for (const auto& obstacle : m_obstacles) {
-            Intersection intersection = rayObstacleIntersection(ray, obstacle);
-            if (intersection.valid && intersection.distance < minDist) {
-                minDist = intersection.distance;
-                closestPoint = intersection.point;
-                hitObstacle = true;
-            }
-        }
-        
-        // Update ray if it hit an obstacle
-        if (hitObstacle) {
-            ray.distance = minDist;
-            ray.endPoint = closestPoint;
-        }
-        
+        ray.distance = vertex.distance;
+        ray.endPoint = vertex.point;
+        ray.direction = vertex.distance > 0.0f ? (vertex.point - origin) / vertex.distance : sf::Vector2f(1.0f, 0.0f);
         rays.push_back(ray);
     }
 }
 //-------------------------------------------------------------------------------------
-DarkLevelSystem::Intersection DarkLevelSystem::rayObstacleIntersection(const Ray& ray, const Obstacle& obstacle) {
-    Intersection result = { {0, 0}, 0.0f, false };
-    
-    // Convert rectangle to four line segments
-    sf::FloatRect bounds = obstacle.bounds;
-    sf::Vector2f topLeft = {bounds.left, bounds.top};
-    sf::Vector2f topRight = {bounds.left + bounds.width, bounds.top};
-    sf::Vector2f bottomRight = {bounds.left + bounds.width, bounds.top + bounds.height};
-    sf::Vector2f bottomLeft = {bounds.left, bounds.top + bounds.height};
-    
-    // Ray endpoints
-    sf::Vector2f rayEnd = ray.origin + ray.direction * ray.distance;
-    
-    // Check intersection with each edge
-    sf::Vector2f edges[4][2] = {
-        {topLeft, topRight},
-        {topRight, bottomRight},
-        {bottomRight, bottomLeft},
-        {bottomLeft, topLeft}
-    };
-    
-    float minDist = ray.distance;
-    bool found = false;
-    sf::Vector2f closestIntersection;
-    
-    for (const auto& edge : edges) {
-        sf::Vector2f intersection = calculateIntersection(ray.origin, rayEnd, edge[0], edge[1]);
-        
-        // Check if intersection is valid and within the ray's range
-        sf::Vector2f dir = intersection - ray.origin;
-        float dist = std::sqrt(dir.x * dir.x + dir.y * dir.y);
-        
-        bool onSegment = true;
-        if (std::isnan(intersection.x) || std::isnan(intersection.y)) {
-            onSegment = false;
-        }
-        
-        // Calculate dot product to make sure the intersection is in front of the ray
-        float dotProduct = dir.x * ray.direction.x + dir.y * ray.direction.y;
-        
-        if (onSegment && dotProduct > 0 && dist < minDist) {
-            minDist = dist;
-            closestIntersection = intersection;
-            found = true;
-        }
-    }
-    
-    if (found) {
-        result.point = closestIntersection;
-        result.distance = minDist;
-        result.valid = true;
-    }
-    
-    return result;
-}
-//-------------------------------------------------------------------------------------
-sf::Vector2f DarkLevelSystem::calculateIntersection(
-    const sf::Vector2f& rayStart, const sf::Vector2f& rayEnd, 
-    const sf::Vector2f& segStart, const sf::Vector2f& segEnd) {
-    
-    // Calculate direction vectors
-    sf::Vector2f r = rayEnd - rayStart;
-    sf::Vector2f s = segEnd - segStart;
-    
-    // Calculate cross product of r and s
-    float rxs = r.x * s.y - r.y * s.x;
-    
-    // Check if lines are parallel (or collinear)
-    if (std::abs(rxs) < 0.0001f) {
-        return sf::Vector2f(std::numeric_limits<float>::quiet_NaN(), 
-                          std::numeric_limits<float>::quiet_NaN());
-    }
-    
-    // Calculate parameters t and u
-    sf::Vector2f qp = segStart - rayStart;
-    float t = (qp.x * s.y - qp.y * s.x) / rxs;
-    float u = (qp.x * r.y - qp.y * r.x) / rxs;
-    
-    // Check if intersection is within segments
-    if (t >= 0 && t <= 1 && u >= 0 && u <= 1) {
-        return rayStart + t * r;
-    }
-    
-    return sf::Vector2f(std::numeric_limits<float>::quiet_NaN(), 
-                      std::numeric_limits<float>::quiet_NaN());
-}
-//-------------------------------------------------------------------------------------
-void DarkLevelSystem::renderFlashlight(sf::RenderWindow& window) {
-    float currentIntensity = m_flashlightIntensity ;
-    float flicker = 1.0f;
-
-    currentIntensity *= flicker;
-
-    sf::VertexArray cone(sf::TriangleFan);
-    cone.append(sf::Vertex(m_playerLightPos, sf::Color(255, 255, 200, 200)));
-
-    float spreadAngle = 60.0f;
-    float angleStep = spreadAngle / m_rayCount;
-    float startAngle = (m_flashlightDirection.x > 0 ? 0.0f : 180.0f) - spreadAngle / 2.0f;
-
-    for (int i = 0; i <= m_rayCount; ++i) {
-        float angleDeg = startAngle + i * angleStep;
-        float angleRad = angleDeg * M_PI / 180.0f;
-
-        sf::Vector2f direction(std::cos(angleRad), std::sin(angleRad));
-        sf::Vector2f endPoint = m_playerLightPos + direction * 250.0f;
-
-        cone.append(sf::Vertex(endPoint, sf::Color(255, 255, 200, 0)));
-    }
-
-    m_flashlightTexture->draw(cone);  
-}
-//-------------------------------------------------------------------------------------
-void DarkLevelSystem::drawFlashlightCone(float intensity) {
+void DarkLevelSystem::buildFlashlightCone(float intensity) {
+    // Reuses the cone's vertex storage from the previous frame
+    sf::VertexArray& flashlightCone = m_flashlightCone;
+    flashlightCone.clear();
     if (m_playerLightPos.x == 0 && m_playerLightPos.y == 0) return;
-
-    // Create a vertex array for the flashlight cone with better illumination
-    sf::VertexArray flashlightCone(sf::TriangleFan);
     
     // Start at the player position (flashlight center)
     sf::Vector2f center = m_playerLightPos;
@@ -355,8 +239,7 @@ void DarkLevelSystem::drawFlashlightCone(float intensity) {
     float directionAngle = std::atan2(m_flashlightDirection.y, m_flashlightDirection.x);
     
     // Create the cone segments with better light distribution
-    int segments = 30; // More segments for smoother cone
-    std::vector<Ray> flashlightRays;
+    int segments = m_coneSegments; // Set by the quality controller
     
     for (int i = 0; i <= segments; ++i) {
         float segmentAngle = directionAngle - angleRad / 2 + (angleRad * i / segments);
@@ -369,22 +252,10 @@ void DarkLevelSystem::drawFlashlightCone(float intensity) {
         ray.endPoint = center + ray.direction * m_flashlightRange;
         
         // Check for obstacles and create light refraction effect
-        float minDist = m_flashlightRange;
-        sf::Vector2f closestPoint;
-        bool hitObstacle = false;
-        
-        for (const auto& obstacle : m_obstacles) {
-            Intersection intersection = rayObstacleIntersection(ray, obstacle);
-            if (intersection.valid && intersection.distance < minDist) {
-                minDist = intersection.distance;
-                closestPoint = intersection.point;
-                hitObstacle = true;
-            }
-        }
-        
-        // Update ray if it hit an obstacle
-        if (hitObstacle) {
-            ray.distance = minDist;
+        ObstacleGrid::RayHit hit;
+        if (m_obstacles.raycast(center, ray.direction, m_flashlightRange, hit)) {
+            sf::Vector2f closestPoint = hit.point;
+            ray.distance = hit.distance;
             ray.endPoint = closestPoint;
             
             // Add light refraction/reflection effect
@@ -408,12 +279,7 @@ void DarkLevelSystem::drawFlashlightCone(float intensity) {
         
         // Use brighter, more natural light color that reveals object colors
         flashlightCone.append(sf::Vertex(ray.endPoint, sf::Color(255, 255, 240, alpha)));
-        flashlightRays.push_back(ray);
     }
-    
-    // Draw the flashlight cone
-    m_flashlightTexture->draw(flashlightCone);
-    
 }
 //-------------------------------------------------------------------------------------
 void DarkLevelSystem::updateFlashlightDirection(const sf::Vector2f& playerPos, const sf::Vector2f& targetPos) {
@@ -424,48 +290,76 @@ void DarkLevelSystem::updateFlashlightDirection(const sf::Vector2f& playerPos, c
     }
 }
 //-------------------------------------------------------------------------------------
-void DarkLevelSystem::renderLightSources(sf::RenderTexture& target) {
+void DarkLevelSystem::buildLightMeshes() {
+    // Only lights whose surroundings changed cast their rays again; hidden
+    // ambient lights stay dirty until they are shown
+    m_pendingLights.clear();
+    if (m_ambientLightsVisible) {
+        for (auto& light : m_lightSources) {
+            if (light.dirty) {
+                m_pendingLights.push_back(&light);
+            }
+        }
+    }
+    m_lightRebuilds = m_pendingLights.size();
+
+    // The flashlight cone is the last job; every job writes only its own mesh
+    bool flashlight = m_flashlightOn && m_playerLightPos.x != 0 && m_playerLightPos.y != 0;
+    if (!flashlight) {
+        m_flashlightCone.clear();
+    }
+    std::size_t jobCount = m_pendingLights.size() + (flashlight ? 1 : 0);
+
+    JobSystem::instance().parallelFor(jobCount, [this](std::size_t index) {
+        if (index < m_pendingLights.size()) {
+            rebuildLightMesh(*m_pendingLights[index]);
+        }
+        else {
+            buildFlashlightCone(m_flashlightIntensity);
+        }
+    });
+}
+//-------------------------------------------------------------------------------------
+void DarkLevelSystem::renderLightSources(RenderCommandList& commands) {
     // Use additive blending for light sources
     sf::BlendMode additiveBlend(sf::BlendMode::One, sf::BlendMode::One);
-    
+
     for (const auto& light : m_lightSources) {
-        // Cast rays from this light source to create shadow map
-        std::vector<Ray> rays;
-        castRays(light.position, rays, light.radius);
-        
-        // Create the light mesh with shadows
-        sf::VertexArray lightMesh(sf::TriangleFan);
-        lightMesh.append(sf::Vertex(light.position, light.color));
-        
-        // Add all ray endpoints
-        for (const auto& ray : rays) {
-            sf::Color rayColor = light.color;
-            rayColor.a = static_cast<sf::Uint8>(255 * light.intensity * 
-                                              (1.0f - ray.distance / light.radius));
-            lightMesh.append(sf::Vertex(ray.endPoint, rayColor));
-        }
-        
-        // Close the mesh
-        if (!rays.empty()) {
-            sf::Color rayColor = light.color;
-            rayColor.a = static_cast<sf::Uint8>(255 * light.intensity * 
-                                              (1.0f - rays[0].distance / light.radius));
-            lightMesh.append(sf::Vertex(rays[0].endPoint, rayColor));
+        // Draw the light with shadows and its soft halo
+        commands.draw(light.mesh, additiveBlend);
+        commands.draw(light.halo, additiveBlend);
+    }
+}
+//-------------------------------------------------------------------------------------
+void DarkLevelSystem::rebuildLightMesh(LightSource& light) const {
+    castRays(light.position, light.radius, light.workspace);
+    const std::vector<Ray>& rays = light.workspace.rays;
+
+    light.mesh.clear();
+    light.mesh.append(sf::Vertex(light.position, light.color));
+
+    // Add all ray endpoints
+    for (const auto& ray : rays) {
+        sf::Color rayColor = light.color;
+        rayColor.a = static_cast<sf::Uint8>(255 * light.intensity *
+                                          (1.0f - ray.distance / light.radius));
+        light.mesh.append(sf::Vertex(ray.endPoint, rayColor));
+    }
+
+    // Close the mesh
+    if (!rays.empty()) {
+        light.mesh.append(light.mesh[1]);
+    }
+    light.dirty = false;
+}
+//-------------------------------------------------------------------------------------
+void DarkLevelSystem::invalidateLights(const sf::FloatRect& area) {
+    for (auto& light : m_lightSources) {
+        float dx = light.position.x - std::clamp(light.position.x, area.left, area.left + area.width);
+        float dy = light.position.y - std::clamp(light.position.y, area.top, area.top + area.height);
+        if (dx * dx + dy * dy <= light.radius * light.radius) {
+            light.dirty = true;
         }
-        
-        // Draw the light with shadows
-        target.draw(lightMesh, additiveBlend);
-        
-        // Draw a soft light halo
-        sf::CircleShape halo(light.radius * 0.5f);
-        halo.setOrigin(light.radius * 0.5f, light.radius * 0.5f);
-        halo.setPosition(light.position);
-        
-        sf::Color haloColor = light.color;
-        haloColor.a = static_cast<sf::Uint8>(100 * light.intensity);
-        halo.setFillColor(haloColor);
-        
-        target.draw(halo, additiveBlend);
     }
 }
 //-------------------------------------------------------------------------------------
@@ -481,6 +375,15 @@ void DarkLevelSystem::addLightSource(const sf::Vector2f& position, float radius,
     light.radius = radius;
     light.color = color;
     light.intensity = 1.0f;
+    light.workspace.visibility.setArcSegments(m_arcSegments);
+
+    light.halo.setRadius(radius * 0.5f);
+    light.halo.setOrigin(radius * 0.5f, radius * 0.5f);
+    light.halo.setPosition(position);
+    sf::Color haloColor = color;
+    haloColor.a = static_cast<sf::Uint8>(100 * light.intensity);
+    light.halo.setFillColor(haloColor);
+
     m_lightSources.push_back(light);
 }
 //-------------------------------------------------------------------------------------
@@ -488,28 +391,123 @@ void DarkLevelSystem::clearLightSources() {
     m_lightSources.clear();
 }
 //-------------------------------------------------------------------------------------
-void DarkLevelSystem::registerObstacle(const sf::FloatRect& bounds) {
-    Obstacle obstacle;
-    obstacle.bounds = bounds;
-    m_obstacles.push_back(obstacle);
+ObstacleGrid::Id DarkLevelSystem::registerObstacle(const sf::FloatRect& bounds) {
+    invalidateLights(bounds);
+    return m_obstacles.add(bounds);
+}
+//-------------------------------------------------------------------------------------
+void DarkLevelSystem::attach(EntityManager& entityManager) {
+    if (m_source) {
+        m_source->removeListener(this);
+    }
+    clearObstacles();
+    m_pendingEntities = entityManager.getAllEntities();
+
+    m_source = &entityManager;
+    m_source->addListener(this);
+}
+//-------------------------------------------------------------------------------------
+void DarkLevelSystem::detach() {
+    if (m_source) {
+        m_source->removeListener(this);
+        m_source = nullptr;
+    }
+    m_pendingEntities.clear();
+    clearObstacles();
+}
+//-------------------------------------------------------------------------------------
+void DarkLevelSystem::onEntityAdded(Entity* entity) {
+    // Spawn positions may still be adjusted by the creator, so wait for update()
+    m_pendingEntities.push_back(entity);
+}
+//-------------------------------------------------------------------------------------
+void DarkLevelSystem::onEntityRemoved(Entity* entity) {
+    std::erase(m_pendingEntities, entity);
+    std::erase(m_movingCasters, entity);
+
+    auto it = m_entityObstacles.find(entity);
+    if (it != m_entityObstacles.end()) {
+        removeObstacle(it->second);
+        m_entityObstacles.erase(it);
+    }
+}
+//-------------------------------------------------------------------------------------
+void DarkLevelSystem::syncEntityObstacles() {
+    for (Entity* entity : m_pendingEntities) {
+        if (!castsShadow(entity) || m_entityObstacles.count(entity)) {
+            continue;
+        }
+        m_entityObstacles[entity] = registerObstacle(boundsOf(entity));
+        if (isMobile(entity)) {
+            m_movingCasters.push_back(entity);
+        }
+    }
+    m_pendingEntities.clear();
+
+    // Only casters that actually moved invalidate the lights around them
+    for (Entity* entity : m_movingCasters) {
+        ObstacleGrid::Id id = m_entityObstacles[entity];
+        sf::FloatRect bounds = boundsOf(entity);
+        const sf::FloatRect& previous = m_obstacles.getBounds(id);
+        if (std::abs(bounds.left - previous.left) > 0.5f || std::abs(bounds.top - previous.top) > 0.5f ||
+            std::abs(bounds.width - previous.width) > 0.5f || std::abs(bounds.height - previous.height) > 0.5f) {
+            moveObstacle(id, bounds);
+        }
+    }
+}
+//-------------------------------------------------------------------------------------
+bool DarkLevelSystem::castsShadow(Entity* entity) {
+    if (!entity || !entity->getComponent<Transform>() || !entity->getComponent<RenderComponent>()) {
+        return false;
+    }
+    auto* collision = entity->getComponent<CollisionComponent>();
+    return collision && (collision->getType() == CollisionComponent::CollisionType::Ground ||
+                         collision->getType() == CollisionComponent::CollisionType::Obstacle);
+}
+//-------------------------------------------------------------------------------------
+bool DarkLevelSystem::isMobile(Entity* entity) {
+    auto* physics = entity->getComponent<PhysicsComponent>();
+    return physics && physics->getBody() && physics->getBody()->GetType() != b2_staticBody;
+}
+//-------------------------------------------------------------------------------------
+sf::FloatRect DarkLevelSystem::boundsOf(Entity* entity) {
+    // Same bounds the renderer uses: sprite placed at the transform
+    auto& sprite = entity->getComponent<RenderComponent>()->getSprite();
+    sprite.setPosition(entity->getComponent<Transform>()->getPosition());
+    return sprite.getGlobalBounds();
+}
+//-------------------------------------------------------------------------------------
+void DarkLevelSystem::moveObstacle(ObstacleGrid::Id id, const sf::FloatRect& bounds) {
+    if (!m_obstacles.contains(id)) {
+        return;
+    }
+    // Lights around both the old and the new place see the change
+    invalidateLights(m_obstacles.getBounds(id));
+    invalidateLights(bounds);
+    m_obstacles.move(id, bounds);
+}
+//-------------------------------------------------------------------------------------
+void DarkLevelSystem::removeObstacle(ObstacleGrid::Id id) {
+    if (!m_obstacles.contains(id)) {
+        return;
+    }
+    invalidateLights(m_obstacles.getBounds(id));
+    m_obstacles.remove(id);
 }
 //-------------------------------------------------------------------------------------
 void DarkLevelSystem::clearObstacles() {
     m_obstacles.clear();
+    m_entityObstacles.clear();
+    m_movingCasters.clear();
+    for (auto& light : m_lightSources) {
+        light.dirty = true;
+    }
 }
 //-------------------------------------------------------------------------------------
 void DarkLevelSystem::setObstacles(const std::vector<sf::FloatRect>& obstacles) {
-    m_obstacles.clear();
+    clearObstacles();
     for (const auto& rect : obstacles) {
         registerObstacle(rect);
     }
 }
 //-------------------------------------------------------------------------------------
-void DarkLevelSystem::drawRedEyes(sf::RenderWindow& window, EntityManager& entityManager) {
-    for (Entity* entity : entityManager.getAllEntities()) {
-        if (auto* smart = dynamic_cast<SmartEnemyEntity*>(entity)) {
-            smart->drawEyes(window); 
-        }
-    }
-}
-//-------------------------------------------------------------------------------------
\ No newline at end of file
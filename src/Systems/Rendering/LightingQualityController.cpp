@@ -0,0 +1,61 @@
+#include "LightingQualityController.h"
+#include <algorithm>
+
+namespace {
+    constexpr float SMOOTHING = 0.1f;        // Weight of the newest frame in the average
+    constexpr float RAISE_THRESHOLD = 0.6f;  // Fraction of the budget that allows a higher level
+    constexpr int FRAMES_TO_LOWER = 15;
+    constexpr int FRAMES_TO_RAISE = 90;
+    constexpr int COOLDOWN_FRAMES = 30;
+    constexpr std::size_t DEFAULT_LEVEL = 3;
+}
+
+//-------------------------------------------------------------------------------------
+LightingQualityController::LightingQualityController(float budgetMs)
+    : m_levels{
+        { 12, 24, 4 },
+        { 20, 32, 4 },
+        { 30, 48, 2 },
+        { 30, 64, 2 },   // The original fixed settings
+        { 48, 96, 2 },   // Fill cost is paid on the render thread and not measured, so never a full-size lightmap
+      },
+      m_level(DEFAULT_LEVEL),
+      m_budgetMs(budgetMs) {
+}
+//-------------------------------------------------------------------------------------
+bool LightingQualityController::update(float lightingMs) {
+    m_lastMs = lightingMs;
+    m_averageMs = m_averageMs == 0.0f ? lightingMs : m_averageMs + (lightingMs - m_averageMs) * SMOOTHING;
+
+    if (m_cooldown > 0) {
+        --m_cooldown;
+        return false;
+    }
+
+    m_framesOver = m_averageMs > m_budgetMs ? m_framesOver + 1 : 0;
+    m_framesUnder = m_averageMs < m_budgetMs * RAISE_THRESHOLD ? m_framesUnder + 1 : 0;
+
+    std::size_t level = m_level;
+    if (m_framesOver >= FRAMES_TO_LOWER && m_level > 0) {
+        level = m_level - 1;
+    }
+    else if (m_framesUnder >= FRAMES_TO_RAISE && m_level + 1 < m_levels.size()) {
+        level = m_level + 1;
+    }
+
+    if (level == m_level) {
+        return false;
+    }
+
+    setLevel(level);
+    ++m_levelChanges;
+    return true;
+}
+//-------------------------------------------------------------------------------------
+void LightingQualityController::setLevel(std::size_t level) {
+    m_level = std::min(level, m_levels.size() - 1);
+    m_framesOver = 0;
+    m_framesUnder = 0;
+    m_cooldown = COOLDOWN_FRAMES;
+}
+//-------------------------------------------------------------------------------------
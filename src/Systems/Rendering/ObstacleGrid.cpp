@@ -0,0 +1,247 @@
+#include "ObstacleGrid.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+//-------------------------------------------------------------------------------------
+ObstacleGrid::ObstacleGrid(float cellSize)
+    : m_cellSize(cellSize > 0.f ? cellSize : 1.f) {
+}
+//-------------------------------------------------------------------------------------
+ObstacleGrid::CellKey ObstacleGrid::makeKey(int cellX, int cellY) {
+    return (static_cast<CellKey>(cellX) << 32) ^ static_cast<std::uint32_t>(cellY);
+}
+//-------------------------------------------------------------------------------------
+int ObstacleGrid::cellCoord(float value) const {
+    return static_cast<int>(std::floor(value / m_cellSize));
+}
+//-------------------------------------------------------------------------------------
+ObstacleGrid::Id ObstacleGrid::add(const sf::FloatRect& bounds) {
+    Id id;
+    if (!m_freeIds.empty()) {
+        id = m_freeIds.back();
+        m_freeIds.pop_back();
+    }
+    else {
+        id = static_cast<Id>(m_obstacles.size());
+        m_obstacles.emplace_back();
+    }
+
+    m_obstacles[id].bounds = bounds;
+    m_obstacles[id].alive = true;
+    ++m_count;
+    link(id);
+    return id;
+}
+//-------------------------------------------------------------------------------------
+void ObstacleGrid::remove(Id id) {
+    if (!contains(id)) {
+        return;
+    }
+    unlink(id);
+    m_obstacles[id].alive = false;
+    m_freeIds.push_back(id);
+    --m_count;
+}
+//-------------------------------------------------------------------------------------
+void ObstacleGrid::move(Id id, const sf::FloatRect& bounds) {
+    if (!contains(id)) {
+        return;
+    }
+    unlink(id);
+    m_obstacles[id].bounds = bounds;
+    link(id);
+}
+//-------------------------------------------------------------------------------------
+void ObstacleGrid::clear() {
+    m_obstacles.clear();
+    m_freeIds.clear();
+    m_cells.clear();
+    m_count = 0;
+}
+//-------------------------------------------------------------------------------------
+void ObstacleGrid::link(Id id) {
+    const sf::FloatRect& bounds = m_obstacles[id].bounds;
+    int minX = cellCoord(bounds.left);
+    int maxX = cellCoord(bounds.left + bounds.width);
+    int minY = cellCoord(bounds.top);
+    int maxY = cellCoord(bounds.top + bounds.height);
+
+    for (int x = minX; x <= maxX; ++x) {
+        for (int y = minY; y <= maxY; ++y) {
+            m_cells[makeKey(x, y)].push_back(id);
+        }
+    }
+}
+//-------------------------------------------------------------------------------------
+void ObstacleGrid::unlink(Id id) {
+    const sf::FloatRect& bounds = m_obstacles[id].bounds;
+    int minX = cellCoord(bounds.left);
+    int maxX = cellCoord(bounds.left + bounds.width);
+    int minY = cellCoord(bounds.top);
+    int maxY = cellCoord(bounds.top + bounds.height);
+
+    for (int x = minX; x <= maxX; ++x) {
+        for (int y = minY; y <= maxY; ++y) {
+            auto cell = m_cells.find(makeKey(x, y));
+            if (cell == m_cells.end()) {
+                continue;
+            }
+            auto& ids = cell->second;
+            auto it = std::find(ids.begin(), ids.end(), id);
+            if (it != ids.end()) {
+                *it = ids.back();
+                ids.pop_back();
+            }
+            if (ids.empty()) {
+                m_cells.erase(cell);
+            }
+        }
+    }
+}
+//-------------------------------------------------------------------------------------
+void ObstacleGrid::queryRect(const sf::FloatRect& area, std::vector<Id>& out) const {
+    std::size_t first = out.size();
+    int minX = cellCoord(area.left);
+    int maxX = cellCoord(area.left + area.width);
+    int minY = cellCoord(area.top);
+    int maxY = cellCoord(area.top + area.height);
+
+    for (int x = minX; x <= maxX; ++x) {
+        for (int y = minY; y <= maxY; ++y) {
+            auto cell = m_cells.find(makeKey(x, y));
+            if (cell == m_cells.end()) {
+                continue;
+            }
+            for (Id id : cell->second) {
+                if (m_obstacles[id].bounds.intersects(area)) {
+                    out.push_back(id);
+                }
+            }
+        }
+    }
+
+    // Obstacles spanning several cells were collected once per cell
+    std::sort(out.begin() + static_cast<std::ptrdiff_t>(first), out.end());
+    out.erase(std::unique(out.begin() + static_cast<std::ptrdiff_t>(first), out.end()), out.end());
+}
+//-------------------------------------------------------------------------------------
+void ObstacleGrid::queryRadius(const sf::Vector2f& center, float radius, std::vector<Id>& out) const {
+    std::size_t first = out.size();
+    queryRect(sf::FloatRect(center.x - radius, center.y - radius, radius * 2.f, radius * 2.f), out);
+
+    // Drop the box corners that lie outside the circle
+    auto end = std::remove_if(out.begin() + static_cast<std::ptrdiff_t>(first), out.end(), [&](Id id) {
+        const sf::FloatRect& bounds = m_obstacles[id].bounds;
+        float dx = center.x - std::clamp(center.x, bounds.left, bounds.left + bounds.width);
+        float dy = center.y - std::clamp(center.y, bounds.top, bounds.top + bounds.height);
+        return dx * dx + dy * dy > radius * radius;
+    });
+    out.erase(end, out.end());
+}
+//-------------------------------------------------------------------------------------
+bool ObstacleGrid::intersectRay(const sf::FloatRect& bounds, const sf::Vector2f& origin,
+    const sf::Vector2f& inverseDirection, float maxDistance, float& distance) const {
+    float left = bounds.left;
+    float right = bounds.left + bounds.width;
+    float top = bounds.top;
+    float bottom = bounds.top + bounds.height;
+
+    if (origin.x > left && origin.x < right && origin.y > top && origin.y < bottom) {
+        return false;
+    }
+
+    // Slab test. A ray parallel to a slab (infinite inverse) either stays
+    // inside it for its whole length or misses; computing it would give
+    // 0 * inf = NaN when the origin lies on the slab boundary
+    const float infinity = std::numeric_limits<float>::infinity();
+    float tNear = -infinity;
+    float tFar = infinity;
+    auto clipSlab = [&](float low, float high, float start, float inverse) {
+        if (std::isinf(inverse)) {
+            return start >= low && start <= high;
+        }
+        float t1 = (low - start) * inverse;
+        float t2 = (high - start) * inverse;
+        tNear = std::max(tNear, std::min(t1, t2));
+        tFar = std::min(tFar, std::max(t1, t2));
+        return true;
+    };
+    if (!clipSlab(left, right, origin.x, inverseDirection.x) ||
+        !clipSlab(top, bottom, origin.y, inverseDirection.y)) {
+        return false;
+    }
+
+    if (tFar < 0.f || tNear > tFar || tNear > maxDistance) {
+        return false;
+    }
+    distance = std::max(tNear, 0.f);
+    return true;
+}
+//-------------------------------------------------------------------------------------
+bool ObstacleGrid::raycast(const sf::Vector2f& origin, const sf::Vector2f& direction,
+    float maxDistance, RayHit& hit) const {
+    if (m_count == 0) {
+        return false;
+    }
+
+    const float infinity = std::numeric_limits<float>::infinity();
+    sf::Vector2f inverse(direction.x != 0.f ? 1.f / direction.x : infinity,
+        direction.y != 0.f ? 1.f / direction.y : infinity);
+
+    int cellX = cellCoord(origin.x);
+    int cellY = cellCoord(origin.y);
+    int stepX = direction.x > 0.f ? 1 : -1;
+    int stepY = direction.y > 0.f ? 1 : -1;
+
+    // Distance along the ray to the next vertical / horizontal cell border
+    float nextX = static_cast<float>(cellX + (stepX > 0 ? 1 : 0)) * m_cellSize;
+    float nextY = static_cast<float>(cellY + (stepY > 0 ? 1 : 0)) * m_cellSize;
+    float tMaxX = direction.x != 0.f ? (nextX - origin.x) * inverse.x : infinity;
+    float tMaxY = direction.y != 0.f ? (nextY - origin.y) * inverse.y : infinity;
+    float tDeltaX = direction.x != 0.f ? m_cellSize * std::abs(inverse.x) : infinity;
+    float tDeltaY = direction.y != 0.f ? m_cellSize * std::abs(inverse.y) : infinity;
+
+    float best = maxDistance;
+    Id bestId = INVALID_ID;
+    float cellEntry = 0.f;
+
+    while (cellEntry <= best) {
+        auto cell = m_cells.find(makeKey(cellX, cellY));
+        if (cell != m_cells.end()) {
+            for (Id id : cell->second) {
+                float distance;
+                if (intersectRay(m_obstacles[id].bounds, origin, inverse, best, distance) && distance < best) {
+                    best = distance;
+                    bestId = id;
+                }
+            }
+        }
+
+        // A hit inside this cell cannot be beaten by a farther cell
+        float cellExit = std::min(tMaxX, tMaxY);
+        if (bestId != INVALID_ID && best <= cellExit) {
+            break;
+        }
+
+        if (tMaxX < tMaxY) {
+            cellX += stepX;
+            cellEntry = tMaxX;
+            tMaxX += tDeltaX;
+        }
+        else {
+            cellY += stepY;
+            cellEntry = tMaxY;
+            tMaxY += tDeltaY;
+        }
+    }
+
+    if (bestId == INVALID_ID) {
+        return false;
+    }
+    hit.distance = best;
+    hit.point = origin + direction * best;
+    hit.obstacle = bestId;
+    return true;
+}
+//-------------------------------------------------------------------------------------
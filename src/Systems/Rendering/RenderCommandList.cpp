@@ -0,0 +1,373 @@
+#include "RenderCommandList.h"
+#include "SpriteBatch.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    bool sameTransform(const sf::Transform& a, const sf::Transform& b) {
+        return std::equal(a.getMatrix(), a.getMatrix() + 16, b.getMatrix());
+    }
+
+    sf::Vector2f outlineNormal(const sf::Vector2f& p1, const sf::Vector2f& p2) {
+        sf::Vector2f normal(p1.y - p2.y, p2.x - p1.x);
+        float length = std::sqrt(normal.x * normal.x + normal.y * normal.y);
+        return length != 0.f ? normal / length : normal;
+    }
+}
+
+//-------------------------------------------------------------------------------------
+void RenderCommandList::clear() {
+    m_commands.clear();
+    m_vertices.clear();
+    m_views.clear();
+    m_buffers.clear();
+    m_offscreens.clear();
+    m_callbacks.clear();
+}
+//-------------------------------------------------------------------------------------
+void RenderCommandList::setView(const sf::View& view) {
+    Command command;
+    command.type = Type::View;
+    command.resource = static_cast<std::uint32_t>(m_views.size());
+    m_views.push_back(view);
+    m_commands.push_back(command);
+}
+//-------------------------------------------------------------------------------------
+RenderCommandList::Command& RenderCommandList::triangles(const sf::RenderStates& states) {
+    const auto poolSize = static_cast<std::uint32_t>(m_vertices.getVertexCount());
+    if (!m_commands.empty()) {
+        Command& last = m_commands.back();
+        if (last.type == Type::Vertices && last.primitive == sf::Triangles
+            && last.first + last.count == poolSize
+            && last.states.texture == states.texture && last.states.shader == states.shader
+            && last.states.blendMode == states.blendMode
+            && sameTransform(last.states.transform, states.transform)) {
+            return last;
+        }
+    }
+
+    Command command;
+    command.type = Type::Vertices;
+    command.primitive = sf::Triangles;
+    command.first = poolSize;
+    command.states = states;
+    m_commands.push_back(command);
+    return m_commands.back();
+}
+//-------------------------------------------------------------------------------------
+void RenderCommandList::appendTriangles(const sf::Vertex* vertices, std::size_t count, const sf::RenderStates& states) {
+    Command& command = triangles(states);
+    for (std::size_t i = 0; i < count; ++i) {
+        m_vertices.append(vertices[i]);
+    }
+    command.count += static_cast<std::uint32_t>(count);
+}
+//-------------------------------------------------------------------------------------
+void RenderCommandList::draw(const sf::Vertex* vertices, std::size_t count, sf::PrimitiveType type,
+    const sf::RenderStates& states) {
+    if (!vertices || count == 0) {
+        return;
+    }
+    if (type == sf::Triangles) {
+        appendTriangles(vertices, count, states);
+        return;
+    }
+
+    Command command;
+    command.type = Type::Vertices;
+    command.primitive = type;
+    command.first = static_cast<std::uint32_t>(m_vertices.getVertexCount());
+    command.count = static_cast<std::uint32_t>(count);
+    command.states = states;
+    for (std::size_t i = 0; i < count; ++i) {
+        m_vertices.append(vertices[i]);
+    }
+    m_commands.push_back(command);
+}
+//-------------------------------------------------------------------------------------
+void RenderCommandList::draw(const sf::VertexArray& vertices, const sf::RenderStates& states) {
+    if (vertices.getVertexCount() > 0) {
+        draw(&vertices[0], vertices.getVertexCount(), vertices.getPrimitiveType(), states);
+    }
+}
+//-------------------------------------------------------------------------------------
+void RenderCommandList::draw(const sf::Sprite& sprite, const sf::RenderStates& states) {
+    if (!sprite.getTexture()) {
+        return;
+    }
+
+    sf::RenderStates spriteStates = states;
+    spriteStates.texture = sprite.getTexture();
+    Command& command = triangles(spriteStates);
+    SpriteBatch::appendSprite(m_vertices, sprite);
+    command.count += 6;
+}
+//-------------------------------------------------------------------------------------
+void RenderCommandList::draw(const sf::Shape& shape, const sf::RenderStates& states) {
+    const std::size_t pointCount = shape.getPointCount();
+    if (pointCount < 3) {
+        return;
+    }
+
+    // Fill bounds, used for the fan center and for texture coordinates
+    sf::Vector2f minPoint = shape.getPoint(0);
+    sf::Vector2f maxPoint = minPoint;
+    for (std::size_t i = 1; i < pointCount; ++i) {
+        sf::Vector2f point = shape.getPoint(i);
+        minPoint.x = std::min(minPoint.x, point.x);
+        minPoint.y = std::min(minPoint.y, point.y);
+        maxPoint.x = std::max(maxPoint.x, point.x);
+        maxPoint.y = std::max(maxPoint.y, point.y);
+    }
+    sf::Vector2f size = maxPoint - minPoint;
+    sf::Vector2f center = minPoint + size / 2.f;
+
+    const sf::Transform& transform = shape.getTransform();
+    const sf::FloatRect textureRect(shape.getTextureRect());
+    auto fillVertex = [&](const sf::Vector2f& point) {
+        float u = size.x > 0.f ? (point.x - minPoint.x) / size.x : 0.f;
+        float v = size.y > 0.f ? (point.y - minPoint.y) / size.y : 0.f;
+        return sf::Vertex(transform.transformPoint(point), shape.getFillColor(),
+            { textureRect.left + textureRect.width * u, textureRect.top + textureRect.height * v });
+    };
+
+    sf::RenderStates fillStates = states;
+    fillStates.texture = shape.getTexture();
+    Command& fill = triangles(fillStates);
+    const sf::Vertex centerVertex = fillVertex(center);
+    for (std::size_t i = 0; i < pointCount; ++i) {
+        m_vertices.append(centerVertex);
+        m_vertices.append(fillVertex(shape.getPoint(i)));
+        m_vertices.append(fillVertex(shape.getPoint((i + 1) % pointCount)));
+    }
+    fill.count += static_cast<std::uint32_t>(pointCount * 3);
+
+    const float thickness = shape.getOutlineThickness();
+    if (thickness == 0.f) {
+        return;
+    }
+
+    // Same mitred outline as sf::Shape: each corner is pushed out along the
+    // bisector of its two edge normals
+    sf::RenderStates outlineStates = states;
+    outlineStates.texture = nullptr;
+    Command& outline = triangles(outlineStates);
+    const sf::Color color = shape.getOutlineColor();
+    auto corner = [&](std::size_t i, sf::Vector2f& inner, sf::Vector2f& outer) {
+        sf::Vector2f p0 = shape.getPoint((i + pointCount - 1) % pointCount);
+        sf::Vector2f p1 = shape.getPoint(i);
+        sf::Vector2f p2 = shape.getPoint((i + 1) % pointCount);
+        sf::Vector2f n1 = outlineNormal(p0, p1);
+        sf::Vector2f n2 = outlineNormal(p1, p2);
+        sf::Vector2f toCenter = center - p1;
+        if (n1.x * toCenter.x + n1.y * toCenter.y > 0.f) n1 = -n1;
+        if (n2.x * toCenter.x + n2.y * toCenter.y > 0.f) n2 = -n2;
+        float factor = 1.f + (n1.x * n2.x + n1.y * n2.y);
+        sf::Vector2f normal = (n1 + n2) / factor;
+        inner = transform.transformPoint(p1);
+        outer = transform.transformPoint(p1 + normal * thickness);
+    };
+
+    sf::Vector2f firstInner, firstOuter;
+    corner(0, firstInner, firstOuter);
+    sf::Vector2f inner0 = firstInner, outer0 = firstOuter;
+    for (std::size_t i = 1; i <= pointCount; ++i) {
+        sf::Vector2f inner1 = firstInner, outer1 = firstOuter;
+        if (i < pointCount) {
+            corner(i, inner1, outer1);
+        }
+        m_vertices.append(sf::Vertex(inner0, color));
+        m_vertices.append(sf::Vertex(outer0, color));
+        m_vertices.append(sf::Vertex(inner1, color));
+        m_vertices.append(sf::Vertex(inner1, color));
+        m_vertices.append(sf::Vertex(outer0, color));
+        m_vertices.append(sf::Vertex(outer1, color));
+        inner0 = inner1;
+        outer0 = outer1;
+    }
+    outline.count += static_cast<std::uint32_t>(pointCount * 6);
+}
+//-------------------------------------------------------------------------------------
+void RenderCommandList::draw(const sf::Text& text, const sf::RenderStates& states) {
+    const sf::Font* font = text.getFont();
+    if (!font || text.getString().isEmpty()) {
+        return;
+    }
+
+    // Outline glyphs go under the fill glyphs, as in sf::Text
+    sf::RenderStates textStates = states;
+    textStates.texture = &font->getTexture(text.getCharacterSize());
+    if (text.getOutlineThickness() != 0.f) {
+        Command& outline = triangles(textStates);
+        std::size_t before = m_vertices.getVertexCount();
+        appendGlyphs(text, text.getTransform(), true);
+        outline.count += static_cast<std::uint32_t>(m_vertices.getVertexCount() - before);
+    }
+
+    Command& fill = triangles(textStates);
+    std::size_t before = m_vertices.getVertexCount();
+    appendGlyphs(text, text.getTransform(), false);
+    fill.count += static_cast<std::uint32_t>(m_vertices.getVertexCount() - before);
+}
+//-------------------------------------------------------------------------------------
+void RenderCommandList::appendGlyphs(const sf::Text& text, const sf::Transform& transform, bool outline) {
+    // Layout follows sf::Text so recorded text lines up with findCharacterPos()
+    const sf::Font& font = *text.getFont();
+    const sf::String& string = text.getString();
+    const unsigned int size = text.getCharacterSize();
+    const bool bold = (text.getStyle() & sf::Text::Bold) != 0;
+    const float shear = (text.getStyle() & sf::Text::Italic) ? 0.209f : 0.f;
+    const float thickness = outline ? text.getOutlineThickness() : 0.f;
+    const sf::Color color = outline ? text.getOutlineColor() : text.getFillColor();
+
+    float whitespaceWidth = font.getGlyph(U' ', size, bold).advance;
+    const float letterSpacing = (whitespaceWidth / 3.f) * (text.getLetterSpacing() - 1.f);
+    whitespaceWidth += letterSpacing;
+    const float lineSpacing = font.getLineSpacing(size) * text.getLineSpacing();
+
+    float x = 0.f;
+    float y = static_cast<float>(size);
+    sf::Uint32 previous = 0;
+    for (std::size_t i = 0; i < string.getSize(); ++i) {
+        sf::Uint32 current = string[i];
+        if (current == U'\r') {
+            continue;
+        }
+        x += font.getKerning(previous, current, size, bold);
+        previous = current;
+
+        if (current == U' ' || current == U'\t' || current == U'\n') {
+            if (current == U' ') x += whitespaceWidth;
+            else if (current == U'\t') x += whitespaceWidth * 4.f;
+            else { y += lineSpacing; x = 0.f; }
+            continue;
+        }
+
+        const sf::Glyph& glyph = font.getGlyph(current, size, bold, thickness);
+        const float padding = 1.f;
+        float left = glyph.bounds.left - padding;
+        float top = glyph.bounds.top - padding;
+        float right = glyph.bounds.left + glyph.bounds.width + padding;
+        float bottom = glyph.bounds.top + glyph.bounds.height + padding;
+        float u1 = static_cast<float>(glyph.textureRect.left) - padding;
+        float v1 = static_cast<float>(glyph.textureRect.top) - padding;
+        float u2 = static_cast<float>(glyph.textureRect.left + glyph.textureRect.width) + padding;
+        float v2 = static_cast<float>(glyph.textureRect.top + glyph.textureRect.height) + padding;
+
+        sf::Vertex topLeft(transform.transformPoint(x + left - shear * top, y + top), color, { u1, v1 });
+        sf::Vertex topRight(transform.transformPoint(x + right - shear * top, y + top), color, { u2, v1 });
+        sf::Vertex bottomLeft(transform.transformPoint(x + left - shear * bottom, y + bottom), color, { u1, v2 });
+        sf::Vertex bottomRight(transform.transformPoint(x + right - shear * bottom, y + bottom), color, { u2, v2 });
+        m_vertices.append(topLeft);
+        m_vertices.append(topRight);
+        m_vertices.append(bottomLeft);
+        m_vertices.append(bottomLeft);
+        m_vertices.append(topRight);
+        m_vertices.append(bottomRight);
+
+        // The advance always comes from the fill glyph, so outlines stay aligned
+        x += font.getGlyph(current, size, bold).advance + letterSpacing;
+    }
+}
+//-------------------------------------------------------------------------------------
+void RenderCommandList::draw(std::shared_ptr<sf::VertexBuffer> buffer, const sf::RenderStates& states) {
+    if (!buffer) {
+        return;
+    }
+    Command command;
+    command.type = Type::Buffer;
+    command.resource = static_cast<std::uint32_t>(m_buffers.size());
+    command.states = states;
+    m_buffers.push_back(std::move(buffer));
+    m_commands.push_back(command);
+}
+//-------------------------------------------------------------------------------------
+void RenderCommandList::upload(std::shared_ptr<sf::VertexBuffer> buffer, const sf::VertexArray& vertices) {
+    if (!buffer || vertices.getVertexCount() == 0) {
+        return;
+    }
+    Command command;
+    command.type = Type::Upload;
+    command.first = static_cast<std::uint32_t>(m_vertices.getVertexCount());
+    command.count = static_cast<std::uint32_t>(vertices.getVertexCount());
+    command.resource = static_cast<std::uint32_t>(m_buffers.size());
+    for (std::size_t i = 0; i < vertices.getVertexCount(); ++i) {
+        m_vertices.append(vertices[i]);
+    }
+    m_buffers.push_back(std::move(buffer));
+    m_commands.push_back(command);
+}
+//-------------------------------------------------------------------------------------
+void RenderCommandList::beginOffscreen(std::shared_ptr<sf::RenderTexture> target, const sf::View& view,
+    const sf::Color& clearColor) {
+    Command command;
+    command.type = Type::BeginOffscreen;
+    command.resource = static_cast<std::uint32_t>(m_offscreens.size());
+    command.first = static_cast<std::uint32_t>(m_views.size());
+    command.clearColor = clearColor;
+    m_offscreens.push_back(std::move(target));
+    m_views.push_back(view);
+    m_commands.push_back(command);
+}
+//-------------------------------------------------------------------------------------
+void RenderCommandList::endOffscreen() {
+    Command command;
+    command.type = Type::EndOffscreen;
+    m_commands.push_back(command);
+}
+//-------------------------------------------------------------------------------------
+void RenderCommandList::addCallback(Callback callback) {
+    Command command;
+    command.type = Type::Callback;
+    command.resource = static_cast<std::uint32_t>(m_callbacks.size());
+    m_callbacks.push_back(std::move(callback));
+    m_commands.push_back(command);
+}
+//-------------------------------------------------------------------------------------
+void RenderCommandList::replay(sf::RenderTarget& target) const {
+    sf::RenderTarget* current = &target;
+    sf::RenderTexture* offscreen = nullptr;
+
+    for (const Command& command : m_commands) {
+        switch (command.type) {
+        case Type::View:
+            current->setView(m_views[command.resource]);
+            break;
+        case Type::Vertices:
+            if (command.count > 0) {
+                current->draw(&m_vertices[command.first], command.count, command.primitive, command.states);
+            }
+            break;
+        case Type::Buffer:
+            current->draw(*m_buffers[command.resource], command.states);
+            break;
+        case Type::Upload: {
+            sf::VertexBuffer& buffer = *m_buffers[command.resource];
+            if (buffer.getVertexCount() != command.count) {
+                buffer.create(command.count);
+            }
+            buffer.update(&m_vertices[command.first], command.count, 0);
+            break;
+        }
+        case Type::BeginOffscreen:
+            offscreen = m_offscreens[command.resource].get();
+            if (offscreen) {
+                offscreen->setView(m_views[command.first]);
+                offscreen->clear(command.clearColor);
+                current = offscreen;
+            }
+            break;
+        case Type::EndOffscreen:
+            if (offscreen) {
+                offscreen->display();
+                offscreen = nullptr;
+            }
+            current = &target;
+            break;
+        case Type::Callback:
+            m_callbacks[command.resource](*current);
+            break;
+        }
+    }
+}
+//-------------------------------------------------------------------------------------
@@ -0,0 +1,158 @@
+#include "RenderQueue.h"
+#include "SpriteBatch.h"
+#include <numeric>
+
+namespace {
+    constexpr int LAYER_SHIFT = 56;
+    constexpr int TEXTURE_SHIFT = 32;
+    constexpr int DEPTH_SHIFT = 16;
+    constexpr std::uint32_t TEXTURE_ID_MASK = 0xFFFFFF;
+}
+
+//-------------------------------------------------------------------------------------
+void RenderQueue::begin() {
+    m_items.clear();
+    m_passes.clear();
+    m_vertices.clear();
+    m_pending = Stats{};
+}
+//-------------------------------------------------------------------------------------
+void RenderQueue::setLayerView(RenderLayer layer, const sf::View& view) {
+    m_layerViews[static_cast<std::size_t>(layer)] = view;
+}
+//-------------------------------------------------------------------------------------
+std::uint64_t RenderQueue::makeKey(RenderLayer layer, const sf::Texture* texture, std::uint16_t depth) {
+    // Texture 0 is reserved for untextured geometry and passes
+    std::uint32_t textureId = 0;
+    if (texture) {
+        auto it = m_textureIds.find(texture);
+        if (it == m_textureIds.end()) {
+            it = m_textureIds.emplace(texture, static_cast<std::uint32_t>(m_textureIds.size() + 1)).first;
+        }
+        textureId = it->second & TEXTURE_ID_MASK;
+    }
+
+    return (static_cast<std::uint64_t>(layer) << LAYER_SHIFT)
+         | (static_cast<std::uint64_t>(textureId) << TEXTURE_SHIFT)
+         | (static_cast<std::uint64_t>(depth) << DEPTH_SHIFT);
+}
+//-------------------------------------------------------------------------------------
+void RenderQueue::submit(const sf::Sprite& sprite, RenderLayer layer, std::uint16_t depth) {
+    const sf::Texture* texture = sprite.getTexture();
+    if (!texture) {
+        return;
+    }
+
+    Item item;
+    item.key = makeKey(layer, texture, depth);
+    item.texture = texture;
+    item.layer = layer;
+    item.firstVertex = static_cast<std::uint32_t>(m_vertices.getVertexCount());
+    SpriteBatch::appendSprite(m_vertices, sprite);
+    item.vertexCount = static_cast<std::uint32_t>(m_vertices.getVertexCount()) - item.firstVertex;
+    m_items.push_back(item);
+
+    ++m_pending.sprites;
+}
+//-------------------------------------------------------------------------------------
+void RenderQueue::submitCircle(const sf::Vector2f& center, float radius, const sf::Color& fillColor,
+    RenderLayer layer, float outlineThickness, const sf::Color& outlineColor, std::uint16_t depth) {
+    Item item;
+    item.key = makeKey(layer, nullptr, depth);
+    item.layer = layer;
+    item.firstVertex = static_cast<std::uint32_t>(m_vertices.getVertexCount());
+    SpriteBatch::appendCircle(m_vertices, center, radius, fillColor, outlineThickness, outlineColor);
+    item.vertexCount = static_cast<std::uint32_t>(m_vertices.getVertexCount()) - item.firstVertex;
+    m_items.push_back(item);
+
+    ++m_pending.shapes;
+}
+//-------------------------------------------------------------------------------------
+void RenderQueue::submitPass(RenderLayer layer, std::uint16_t depth, Pass pass) {
+    Item item;
+    item.key = makeKey(layer, nullptr, depth);
+    item.layer = layer;
+    item.pass = static_cast<std::int32_t>(m_passes.size());
+    m_passes.push_back(std::move(pass));
+    m_items.push_back(item);
+}
+//-------------------------------------------------------------------------------------
+void RenderQueue::sortItems() {
+    const std::size_t count = m_items.size();
+    m_order.resize(count);
+    m_scratch.resize(count);
+    std::iota(m_order.begin(), m_order.end(), 0u);
+
+    // LSD radix sort, one byte per pass; stable, so equal keys keep submission order
+    for (int shift = 0; shift < 64; shift += 8) {
+        std::array<std::uint32_t, 256> histogram{};
+        for (std::uint32_t index : m_order) {
+            ++histogram[(m_items[index].key >> shift) & 0xFF];
+        }
+
+        // Skip bytes that are identical for every item (e.g. the unused low bits)
+        std::uint32_t firstDigit = (m_items[m_order[0]].key >> shift) & 0xFF;
+        if (histogram[firstDigit] == count) {
+            continue;
+        }
+
+        std::uint32_t offset = 0;
+        for (auto& bucket : histogram) {
+            std::uint32_t size = bucket;
+            bucket = offset;
+            offset += size;
+        }
+        for (std::uint32_t index : m_order) {
+            m_scratch[histogram[(m_items[index].key >> shift) & 0xFF]++] = index;
+        }
+        m_order.swap(m_scratch);
+    }
+}
+//-------------------------------------------------------------------------------------
+void RenderQueue::flush(RenderCommandList& commands) {
+    if (!m_items.empty()) {
+        sortItems();
+    }
+
+    // The command list merges consecutive items with the same texture into
+    // one draw; a run ends at a texture change, a view change or a pass
+    bool runOpen = false;
+    const sf::Texture* runTexture = nullptr;
+    std::optional<RenderLayer> currentLayer;
+
+    for (std::uint32_t index : m_order) {
+        const Item& item = m_items[index];
+
+        if (currentLayer != item.layer) {
+            runOpen = false;
+            currentLayer = item.layer;
+            if (const auto& view = m_layerViews[static_cast<std::size_t>(item.layer)]) {
+                commands.setView(*view);
+            }
+        }
+
+        if (item.pass >= 0) {
+            runOpen = false;
+            m_passes[item.pass](commands);
+            ++m_pending.passes;
+
+            // Passes may switch views; restore the layer's view for what follows
+            if (const auto& view = m_layerViews[static_cast<std::size_t>(item.layer)]) {
+                commands.setView(*view);
+            }
+            continue;
+        }
+
+        if (!runOpen || item.texture != runTexture) {
+            runOpen = true;
+            runTexture = item.texture;
+            ++m_pending.drawCalls;
+        }
+        commands.draw(&m_vertices[item.firstVertex], item.vertexCount, sf::Triangles,
+            sf::RenderStates(item.texture));
+    }
+
+    m_order.clear();
+    m_stats = m_pending;
+}
+//-------------------------------------------------------------------------------------
@@ -1,49 +1,169 @@
 #include "RenderSystem.h"
 #include "RenderComponent.h"
+#include "PhysicsComponent.h"
 #include "Transform.h"
-#include "EnemyEntity.h"
 #include "SmartEnemyEntity.h"
+#include "Constants.h"
+#include <algorithm>
 #include <iostream>
 
+namespace {
+    constexpr std::size_t GRID_REFRESH_PER_FRAME = 64;  // Grid entities re-checked outside the view each frame
+}
+
+//-------------------------------------------------------------------------------------
+RenderSystem::RenderSystem()
+    : m_grid(TILE_SIZE * 2.0f)
+    , m_tileLayer(TILE_SIZE * 8.0f)
+    , m_cullMargin(TILE_SIZE) {
+}
+//-------------------------------------------------------------------------------------
+RenderSystem::~RenderSystem() {
+    if (m_source) {
+        m_source->removeListener(this);
+    }
+}
 //-------------------------------------------------------------------------------------
-void RenderSystem::render(EntityManager& entityManager, sf::RenderWindow& window) {
-    static int frameCount = 0;
-    frameCount++;
+void RenderSystem::attach(EntityManager& entityManager) {
+    if (m_source) {
+        m_source->removeListener(this);
+    }
+    m_grid.clear();
+    m_tileLayer.clear();
+    m_mobile.clear();
+    m_visible.clear();
+    m_pending = entityManager.getAllEntities();
 
-    int totalEntities = 0;
-    int renderedEntities = 0;
-    int enemiesFound = 0;
-    int smartEnemiesFound = 0;
+    m_source = &entityManager;
+    m_source->addListener(this);
+}
+//-------------------------------------------------------------------------------------
+void RenderSystem::render(EntityManager& entityManager, RenderQueue& queue, const sf::View& view) {
+    m_frameCount++;
 
-    for (Entity* entity : entityManager.getAllEntities()) {
-        totalEntities++;
-        if (!entity->isActive()) {
-            continue;
-        }
+    if (m_source != &entityManager) {
+        attach(entityManager);
+    }
+    indexPendingEntities();
+
+    sf::Vector2f size = view.getSize();
+    sf::FloatRect area(view.getCenter().x - size.x / 2.f - m_cullMargin,
+        view.getCenter().y - size.y / 2.f - m_cullMargin,
+        size.x + 2.f * m_cullMargin, size.y + 2.f * m_cullMargin);
+    collectVisible(area);
+
+    // Baked chunks draw themselves as a pass in the tile layer
+    queue.submitPass(RenderLayer::Tiles, 0, [this, area](RenderCommandList& commands) {
+        m_tileDrawCalls = m_tileLayer.draw(commands, area);
+    });
 
-        auto* renderComp = entity->getComponent<RenderComponent>();
-        auto* transform = entity->getComponent<Transform>();
+    for (Entity* entity : m_visible) {
+        const auto* render = entity->getComponent<RenderComponent>();
+        queue.submit(render->getSprite(), render->getLayer(), render->getDepth());
+
+        if (auto* smartEnemy = dynamic_cast<SmartEnemyEntity*>(entity)) {
+            smartEnemy->appendEyes(queue);
+        }
+    }
 
-        if (renderComp && transform) {
-            // Update sprite position from transform
-            sf::Vector2f pos = transform->getPosition();
-            renderComp->getSprite().setPosition(pos);
+    reportStats(queue);
+}
+//-------------------------------------------------------------------------------------
+void RenderSystem::onEntityAdded(Entity* entity) {
+    // Components and spawn positions may still be adjusted by the creator,
+    // so indexing waits until the next frame
+    m_pending.push_back(entity);
+}
+//-------------------------------------------------------------------------------------
+void RenderSystem::onEntityRemoved(Entity* entity) {
+    m_grid.remove(entity);
+    m_tileLayer.remove(entity);
+    std::erase(m_mobile, entity);
+    std::erase(m_pending, entity);
+    std::erase(m_visible, entity);
+}
+//-------------------------------------------------------------------------------------
+void RenderSystem::indexPendingEntities() {
+    for (Entity* entity : m_pending) {
+        if (!isRenderable(entity)) {
+            continue;
+        }
+        if (entity->getComponent<RenderComponent>()->isStatic()) {
+            boundsOf(entity);  // syncs the sprite with its transform before baking
+            m_tileLayer.add(entity);
+        }
+        else if (isMobile(entity)) {
+            m_mobile.push_back(entity);
+        }
+        else {
+            m_grid.insert(entity, boundsOf(entity));
+        }
+    }
+    m_pending.clear();
+}
+//-------------------------------------------------------------------------------------
+void RenderSystem::collectVisible(const sf::FloatRect& area) {
+    // Entities moved while outside the view would stay in their old cell, so
+    // sweep a slice of the grid every frame as well
+    m_grid.refresh(GRID_REFRESH_PER_FRAME, &RenderSystem::boundsOf);
 
-            // Check if this is an enemy
-            if (dynamic_cast<EnemyEntity*>(entity)) {
-                enemiesFound++;
-            }
+    m_candidates.clear();
+    m_grid.query(area, m_candidates);
 
-            // Draw the sprite first
-            window.draw(renderComp->getSprite());
-            renderedEntities++;
+    m_visible.clear();
+    for (Entity* entity : m_candidates) {
+        if (!entity->isActive()) {
+            continue;
+        }
+        // Static entities can still be moved by gameplay code (e.g. attracted coins)
+        sf::FloatRect bounds = boundsOf(entity);
+        m_grid.update(entity, bounds);
+        if (bounds.intersects(area)) {
+            m_visible.push_back(entity);
+        }
+    }
 
-            // Then draw eyes for smart enemies (on top of the sprite)
-            if (auto* smartEnemy = dynamic_cast<SmartEnemyEntity*>(entity)) {
-                smartEnemiesFound++;
-                smartEnemy->drawEyes(window);
-            }
+    for (Entity* entity : m_mobile) {
+        if (entity->isActive() && boundsOf(entity).intersects(area)) {
+            m_visible.push_back(entity);
         }
     }
+
+    // Stable draw order independent of hash-bucket layout
+    std::sort(m_visible.begin(), m_visible.end(), [](const Entity* a, const Entity* b) {
+        return a->getId() < b->getId();
+    });
+}
+//-------------------------------------------------------------------------------------
+bool RenderSystem::isRenderable(Entity* entity) {
+    return entity && entity->getComponent<RenderComponent>() && entity->getComponent<Transform>();
+}
+//-------------------------------------------------------------------------------------
+bool RenderSystem::isMobile(Entity* entity) {
+    auto* physics = entity->getComponent<PhysicsComponent>();
+    return physics && physics->getBody() && physics->getBody()->GetType() != b2_staticBody;
+}
+//-------------------------------------------------------------------------------------
+sf::FloatRect RenderSystem::boundsOf(Entity* entity) {
+    // Keep the sprite in sync with the transform; the bounds then include origin and scale
+    auto& sprite = entity->getComponent<RenderComponent>()->getSprite();
+    sprite.setPosition(entity->getComponent<Transform>()->getPosition());
+    return sprite.getGlobalBounds();
+}
+//-------------------------------------------------------------------------------------
+void RenderSystem::reportStats(const RenderQueue& queue) const {
+    if (m_statsInterval <= 0 || m_frameCount % m_statsInterval != 0) {
+        return;
+    }
+
+    // Queue counters describe the last flushed frame
+    const auto& stats = queue.getStats();
+    std::cout << "[RenderSystem] Frame " << m_frameCount
+              << " - visible: " << getVisibleCount() << "/" << getTotalCount()
+              << ", sprites: " << stats.sprites
+              << ", shapes: " << stats.shapes
+              << ", tile chunks: " << m_tileLayer.getVisibleChunkCount() << "/" << m_tileLayer.getChunkCount()
+              << ", passes: " << stats.passes
+              << ", draw calls: " << stats.drawCalls + m_tileDrawCalls << std::endl;
 }
-//-------------------------------------------------------------------------------------
\ No newline at end of file
+//-------------------------------------------------------------------------------------
@@ -0,0 +1,234 @@
+#include "RenderThread.h"
+#include <iostream>
+
+namespace {
+    std::atomic<RenderThread*> s_current{ nullptr };
+    constexpr float SMOOTHING = 0.1f;   // Weight of the newest frame in the replay average
+    constexpr sf::Uint32 FIRST_PREPARED_GLYPH = 0x20;
+    constexpr sf::Uint32 LAST_PREPARED_GLYPH = 0x7E;
+}
+
+//-------------------------------------------------------------------------------------
+RenderThread::RenderThread(sf::RenderWindow& window, unsigned int framerateLimit)
+    : m_window(window), m_framerateLimit(framerateLimit) {
+    // The render thread paces frames itself; the window's limiter would sleep
+    // inside display() while the window is locked
+    m_window.setFramerateLimit(0);
+    m_window.setActive(false);
+    m_thread = std::thread(&RenderThread::run, this);
+    s_current = this;
+}
+//-------------------------------------------------------------------------------------
+RenderThread::~RenderThread() {
+    s_current = nullptr;
+    waitIdle();
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopping = true;
+    }
+    m_changed.notify_all();
+    if (m_thread.joinable()) {
+        m_thread.join();
+    }
+
+    // Hand the window back to the main thread as it was before
+    m_window.setActive(true);
+    m_window.setFramerateLimit(m_framerateLimit);
+}
+//-------------------------------------------------------------------------------------
+RenderThread* RenderThread::current() {
+    return s_current;
+}
+//-------------------------------------------------------------------------------------
+void RenderThread::prepareGlyphs(const sf::Font& font, unsigned int characterSize, float outlineThickness) {
+    if (RenderThread* thread = current()) {
+        thread->waitIdle();
+    }
+    for (sf::Uint32 codePoint = FIRST_PREPARED_GLYPH; codePoint <= LAST_PREPARED_GLYPH; ++codePoint) {
+        font.getGlyph(codePoint, characterSize, false);
+        if (outlineThickness != 0.f) {
+            font.getGlyph(codePoint, characterSize, false, outlineThickness);
+        }
+    }
+}
+//-------------------------------------------------------------------------------------
+void RenderThread::prepareGlyphs(const sf::Text& text) {
+    if (const sf::Font* font = text.getFont()) {
+        prepareGlyphs(*font, text.getCharacterSize(), text.getOutlineThickness());
+    }
+}
+//-------------------------------------------------------------------------------------
+RenderCommandList& RenderThread::beginFrame() {
+    RenderCommandList& commands = m_lists[m_writeIndex];
+    commands.clear();
+    return commands;
+}
+//-------------------------------------------------------------------------------------
+void RenderThread::submitFrame() {
+    bool sync = false;
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_changed.wait(lock, [this] { return !m_hasReady; });
+        sync = m_lists[m_writeIndex].requiresSync();
+        std::swap(m_writeIndex, m_readyIndex);
+        m_hasReady = true;
+        ++m_submitted;
+    }
+    m_changed.notify_all();
+
+    if (sync) {
+        waitIdle();
+    }
+}
+//-------------------------------------------------------------------------------------
+void RenderThread::waitIdle() {
+    // The pending frames cannot be presented while this thread holds the window
+    const bool ownsWindow = m_windowOwner == std::this_thread::get_id();
+    if (ownsWindow) {
+        m_windowOwner = std::thread::id();
+        m_windowMutex.unlock();
+    }
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_changed.wait(lock, [this] { return !m_hasReady && m_presented == m_submitted; });
+    }
+    if (ownsWindow) {
+        m_windowMutex.lock();
+        m_windowOwner = std::this_thread::get_id();
+    }
+}
+//-------------------------------------------------------------------------------------
+void RenderThread::run() {
+    m_window.setActive(true);
+
+    const sf::Time frameTime = m_framerateLimit > 0 ? sf::seconds(1.0f / m_framerateLimit) : sf::Time::Zero;
+    sf::Clock frameClock;
+
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_changed.wait(lock, [this] { return m_hasReady || m_pauseRequested || m_stopping; });
+
+            if (m_pauseRequested) {
+                // Give the context away until the exclusive user is done
+                m_window.setActive(false);
+                m_paused = true;
+                m_changed.notify_all();
+                m_changed.wait(lock, [this] { return !m_pauseRequested; });
+                m_window.setActive(true);
+                m_paused = false;
+                m_changed.notify_all();
+                frameClock.restart();
+                continue;
+            }
+            if (!m_hasReady) {
+                break;  // Stopping with nothing left to draw
+            }
+
+            std::swap(m_renderIndex, m_readyIndex);
+            m_hasReady = false;
+        }
+        m_changed.notify_all();
+
+        present(m_lists[m_renderIndex]);
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            ++m_presented;
+        }
+        m_changed.notify_all();
+
+        if (frameTime > sf::Time::Zero) {
+            sf::Time elapsed = frameClock.getElapsedTime();
+            if (elapsed < frameTime) {
+                sf::sleep(frameTime - elapsed);
+            }
+        }
+        frameClock.restart();
+    }
+
+    m_window.setActive(false);
+}
+//-------------------------------------------------------------------------------------
+void RenderThread::present(const RenderCommandList& commands) {
+    std::lock_guard<std::mutex> lock(m_windowMutex);
+    if (!m_window.isOpen()) {
+        return;
+    }
+
+    sf::Clock clock;
+    m_window.clear(sf::Color::Black);
+    try {
+        commands.replay(m_window);
+    }
+    catch (const std::exception& e) {
+        std::cerr << "[RenderThread] Render error: " << e.what() << std::endl;
+    }
+    m_window.display();
+
+    float replayMs = clock.getElapsedTime().asSeconds() * 1000.0f;
+    float average = m_averageReplayMs;
+    m_averageReplayMs = average == 0.0f ? replayMs : average + (replayMs - average) * SMOOTHING;
+}
+//-------------------------------------------------------------------------------------
+void RenderThread::pause() {
+    if (m_pauseDepth++ > 0) {
+        return;
+    }
+
+    waitIdle();
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_pauseRequested = true;
+        m_changed.notify_all();
+        m_changed.wait(lock, [this] { return m_paused; });
+    }
+
+    // Modal loops rely on the window's own limiter
+    m_window.setActive(true);
+    m_window.setFramerateLimit(m_framerateLimit);
+}
+//-------------------------------------------------------------------------------------
+void RenderThread::resume() {
+    if (--m_pauseDepth > 0) {
+        return;
+    }
+
+    m_window.setFramerateLimit(0);
+    m_window.setActive(false);
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_pauseRequested = false;
+        m_changed.notify_all();
+        m_changed.wait(lock, [this] { return !m_paused; });
+    }
+}
+//-------------------------------------------------------------------------------------
+RenderThread::WindowLock::WindowLock(RenderThread* thread)
+    : m_thread(thread) {
+    if (m_thread) {
+        m_thread->m_windowMutex.lock();
+        m_thread->m_windowOwner = std::this_thread::get_id();
+    }
+}
+//-------------------------------------------------------------------------------------
+RenderThread::WindowLock::~WindowLock() {
+    if (m_thread) {
+        m_thread->m_windowOwner = std::thread::id();
+        m_thread->m_windowMutex.unlock();
+    }
+}
+//-------------------------------------------------------------------------------------
+RenderThread::ExclusiveAccess::ExclusiveAccess()
+    : m_thread(RenderThread::current()) {
+    if (m_thread) {
+        m_thread->pause();
+    }
+}
+//-------------------------------------------------------------------------------------
+RenderThread::ExclusiveAccess::~ExclusiveAccess() {
+    if (m_thread) {
+        m_thread->resume();
+    }
+}
+//-------------------------------------------------------------------------------------
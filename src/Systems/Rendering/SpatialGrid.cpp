@@ -0,0 +1,142 @@
+#include "SpatialGrid.h"
+#include <algorithm>
+#include <cmath>
+
+//-------------------------------------------------------------------------------------
+SpatialGrid::SpatialGrid(float cellSize)
+    : m_cellSize(cellSize > 0.f ? cellSize : 1.f) {
+}
+//-------------------------------------------------------------------------------------
+SpatialGrid::CellKey SpatialGrid::makeKey(int cellX, int cellY) {
+    return (static_cast<CellKey>(cellX) << 32) ^ static_cast<std::uint32_t>(cellY);
+}
+//-------------------------------------------------------------------------------------
+SpatialGrid::CellKey SpatialGrid::keyFor(const sf::FloatRect& bounds) const {
+    float centerX = bounds.left + bounds.width * 0.5f;
+    float centerY = bounds.top + bounds.height * 0.5f;
+    return makeKey(static_cast<int>(std::floor(centerX / m_cellSize)),
+        static_cast<int>(std::floor(centerY / m_cellSize)));
+}
+//-------------------------------------------------------------------------------------
+void SpatialGrid::insert(Entity* entity, const sf::FloatRect& bounds) {
+    if (!entity) {
+        return;
+    }
+    if (contains(entity)) {
+        update(entity, bounds);
+        return;
+    }
+
+    m_maxHalfWidth = std::max(m_maxHalfWidth, bounds.width * 0.5f);
+    m_maxHalfHeight = std::max(m_maxHalfHeight, bounds.height * 0.5f);
+
+    CellKey key = keyFor(bounds);
+    m_cells[key].push_back(entity);
+    m_slotOf[entity] = m_entries.size();
+    m_entries.push_back({ entity, key });
+}
+//-------------------------------------------------------------------------------------
+bool SpatialGrid::update(Entity* entity, const sf::FloatRect& bounds) {
+    auto it = m_slotOf.find(entity);
+    if (it == m_slotOf.end()) {
+        insert(entity, bounds);
+        return true;
+    }
+    return moveToCell(m_entries[it->second], bounds);
+}
+//-------------------------------------------------------------------------------------
+bool SpatialGrid::moveToCell(Entry& entry, const sf::FloatRect& bounds) {
+    m_maxHalfWidth = std::max(m_maxHalfWidth, bounds.width * 0.5f);
+    m_maxHalfHeight = std::max(m_maxHalfHeight, bounds.height * 0.5f);
+
+    CellKey key = keyFor(bounds);
+    if (key == entry.cell) {
+        return false;
+    }
+
+    removeFromCell(entry.entity, entry.cell);
+    m_cells[key].push_back(entry.entity);
+    entry.cell = key;
+    return true;
+}
+//-------------------------------------------------------------------------------------
+void SpatialGrid::removeFromCell(Entity* entity, CellKey key) {
+    auto cell = m_cells.find(key);
+    if (cell == m_cells.end()) {
+        return;
+    }
+
+    auto& entities = cell->second;
+    auto pos = std::find(entities.begin(), entities.end(), entity);
+    if (pos != entities.end()) {
+        *pos = entities.back();
+        entities.pop_back();
+    }
+    if (entities.empty()) {
+        m_cells.erase(cell);
+    }
+}
+//-------------------------------------------------------------------------------------
+void SpatialGrid::remove(Entity* entity) {
+    auto it = m_slotOf.find(entity);
+    if (it == m_slotOf.end()) {
+        return;
+    }
+
+    std::size_t slot = it->second;
+    removeFromCell(entity, m_entries[slot].cell);
+    m_slotOf.erase(it);
+
+    // Keep the entries dense; the last one takes the freed slot
+    if (slot + 1 != m_entries.size()) {
+        m_entries[slot] = m_entries.back();
+        m_slotOf[m_entries[slot].entity] = slot;
+    }
+    m_entries.pop_back();
+}
+//-------------------------------------------------------------------------------------
+void SpatialGrid::clear() {
+    m_cells.clear();
+    m_entries.clear();
+    m_slotOf.clear();
+    m_sweep = 0;
+    m_maxHalfWidth = 0.f;
+    m_maxHalfHeight = 0.f;
+}
+//-------------------------------------------------------------------------------------
+std::size_t SpatialGrid::refresh(std::size_t count, const BoundsFunction& boundsOf) {
+    count = std::min(count, m_entries.size());
+    std::size_t moved = 0;
+    for (std::size_t i = 0; i < count; ++i) {
+        if (m_sweep >= m_entries.size()) {
+            m_sweep = 0;
+        }
+        Entry& entry = m_entries[m_sweep++];
+        if (moveToCell(entry, boundsOf(entry.entity))) {
+            ++moved;
+        }
+    }
+    return moved;
+}
+//-------------------------------------------------------------------------------------
+void SpatialGrid::query(const sf::FloatRect& area, std::vector<Entity*>& out) const {
+    if (m_cells.empty()) {
+        return;
+    }
+
+    // Entities are bucketed by center, so widen the area by the largest half-extent
+    int minX = static_cast<int>(std::floor((area.left - m_maxHalfWidth) / m_cellSize));
+    int maxX = static_cast<int>(std::floor((area.left + area.width + m_maxHalfWidth) / m_cellSize));
+    int minY = static_cast<int>(std::floor((area.top - m_maxHalfHeight) / m_cellSize));
+    int maxY = static_cast<int>(std::floor((area.top + area.height + m_maxHalfHeight) / m_cellSize));
+
+    for (int x = minX; x <= maxX; ++x) {
+        for (int y = minY; y <= maxY; ++y) {
+            auto it = m_cells.find(makeKey(x, y));
+            if (it != m_cells.end()) {
+                out.insert(out.end(), it->second.begin(), it->second.end());
+            }
+        }
+    }
+}
+//-------------------------------------------------------------------------------------
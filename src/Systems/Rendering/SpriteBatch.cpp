@@ -0,0 +1,64 @@
+#include "SpriteBatch.h"
+#include <cmath>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+//-------------------------------------------------------------------------------------
+void SpriteBatch::appendSprite(sf::VertexArray& vertices, const sf::Sprite& sprite) {
+    const sf::IntRect& rect = sprite.getTextureRect();
+    float width = static_cast<float>(std::abs(rect.width));
+    float height = static_cast<float>(std::abs(rect.height));
+
+    float left = static_cast<float>(rect.left);
+    float right = left + static_cast<float>(rect.width);
+    float top = static_cast<float>(rect.top);
+    float bottom = top + static_cast<float>(rect.height);
+
+    const sf::Transform& transform = sprite.getTransform();
+    const sf::Color& color = sprite.getColor();
+
+    sf::Vertex topLeft(transform.transformPoint(0.f, 0.f), color, { left, top });
+    sf::Vertex topRight(transform.transformPoint(width, 0.f), color, { right, top });
+    sf::Vertex bottomLeft(transform.transformPoint(0.f, height), color, { left, bottom });
+    sf::Vertex bottomRight(transform.transformPoint(width, height), color, { right, bottom });
+
+    vertices.append(topLeft);
+    vertices.append(bottomLeft);
+    vertices.append(topRight);
+    vertices.append(topRight);
+    vertices.append(bottomLeft);
+    vertices.append(bottomRight);
+}
+//-------------------------------------------------------------------------------------
+void SpriteBatch::appendCircle(sf::VertexArray& vertices, const sf::Vector2f& center, float radius,
+    const sf::Color& fillColor, float outlineThickness, const sf::Color& outlineColor, std::size_t pointCount) {
+    if (pointCount < 3) {
+        pointCount = 3;
+    }
+
+    float step = 2.f * static_cast<float>(M_PI) / static_cast<float>(pointCount);
+    float outerRadius = radius + outlineThickness;
+
+    for (std::size_t i = 0; i < pointCount; ++i) {
+        float a0 = step * static_cast<float>(i);
+        float a1 = step * static_cast<float>(i + 1);
+        sf::Vector2f d0(std::cos(a0), std::sin(a0));
+        sf::Vector2f d1(std::cos(a1), std::sin(a1));
+
+        vertices.append(sf::Vertex(center, fillColor));
+        vertices.append(sf::Vertex(center + d0 * radius, fillColor));
+        vertices.append(sf::Vertex(center + d1 * radius, fillColor));
+
+        if (outlineThickness > 0.f) {
+            vertices.append(sf::Vertex(center + d0 * radius, outlineColor));
+            vertices.append(sf::Vertex(center + d0 * outerRadius, outlineColor));
+            vertices.append(sf::Vertex(center + d1 * radius, outlineColor));
+            vertices.append(sf::Vertex(center + d1 * radius, outlineColor));
+            vertices.append(sf::Vertex(center + d0 * outerRadius, outlineColor));
+            vertices.append(sf::Vertex(center + d1 * outerRadius, outlineColor));
+        }
+    }
+}
+//-------------------------------------------------------------------------------------
@@ -0,0 +1,145 @@
+#include "StaticTileLayer.h"
+#include "SpriteBatch.h"
+#include "Entity.h"
+#include "RenderComponent.h"
+#include <algorithm>
+#include <cmath>
+
+//-------------------------------------------------------------------------------------
+StaticTileLayer::StaticTileLayer(float chunkWidth)
+    : m_chunkWidth(chunkWidth > 0.f ? chunkWidth : 1.f) {
+}
+//-------------------------------------------------------------------------------------
+int StaticTileLayer::columnOf(const Entity* entity) const {
+    const auto& sprite = entity->getComponent<RenderComponent>()->getSprite();
+    sf::FloatRect bounds = sprite.getGlobalBounds();
+    return static_cast<int>(std::floor((bounds.left + bounds.width * 0.5f) / m_chunkWidth));
+}
+//-------------------------------------------------------------------------------------
+void StaticTileLayer::add(Entity* entity) {
+    if (!entity || m_chunkOf.count(entity) > 0 || !entity->getComponent<RenderComponent>()) {
+        return;
+    }
+
+    int column = columnOf(entity);
+    Chunk& chunk = m_chunks[column];
+    chunk.tiles.push_back(entity);
+    chunk.dirty = true;
+    m_chunkOf[entity] = column;
+}
+//-------------------------------------------------------------------------------------
+void StaticTileLayer::remove(Entity* entity) {
+    auto it = m_chunkOf.find(entity);
+    if (it == m_chunkOf.end()) {
+        return;
+    }
+
+    auto chunk = m_chunks.find(it->second);
+    if (chunk != m_chunks.end()) {
+        std::erase(chunk->second.tiles, entity);
+        if (chunk->second.tiles.empty()) {
+            m_chunks.erase(chunk);
+        }
+        else {
+            chunk->second.dirty = true;
+        }
+    }
+    m_chunkOf.erase(it);
+}
+//-------------------------------------------------------------------------------------
+void StaticTileLayer::clear() {
+    m_chunks.clear();
+    m_chunkOf.clear();
+    m_visibleChunks = 0;
+    m_visibleTiles = 0;
+}
+//-------------------------------------------------------------------------------------
+void StaticTileLayer::bake(Chunk& chunk) {
+    chunk.parts.clear();
+    chunk.bounds = sf::FloatRect();
+    bool first = true;
+
+    for (Entity* tile : chunk.tiles) {
+        const auto& sprite = tile->getComponent<RenderComponent>()->getSprite();
+        const sf::Texture* texture = sprite.getTexture();
+        if (!texture) {
+            continue;
+        }
+
+        auto part = std::find_if(chunk.parts.begin(), chunk.parts.end(),
+            [texture](const Part& p) { return p.texture == texture; });
+        if (part == chunk.parts.end()) {
+            chunk.parts.emplace_back();
+            part = std::prev(chunk.parts.end());
+            part->texture = texture;
+        }
+        SpriteBatch::appendSprite(part->vertices, sprite);
+
+        sf::FloatRect bounds = sprite.getGlobalBounds();
+        if (first) {
+            chunk.bounds = bounds;
+            first = false;
+        }
+        else {
+            float right = std::max(chunk.bounds.left + chunk.bounds.width, bounds.left + bounds.width);
+            float bottom = std::max(chunk.bounds.top + chunk.bounds.height, bounds.top + bounds.height);
+            chunk.bounds.left = std::min(chunk.bounds.left, bounds.left);
+            chunk.bounds.top = std::min(chunk.bounds.top, bounds.top);
+            chunk.bounds.width = right - chunk.bounds.left;
+            chunk.bounds.height = bottom - chunk.bounds.top;
+        }
+    }
+
+    // Uploaded once when next drawn; the vertex array stays as fallback when
+    // buffers are unsupported
+    if (sf::VertexBuffer::isAvailable()) {
+        for (auto& part : chunk.parts) {
+            part.buffer = std::make_shared<sf::VertexBuffer>(sf::Triangles, sf::VertexBuffer::Static);
+            part.needsUpload = true;
+        }
+    }
+    chunk.dirty = false;
+}
+//-------------------------------------------------------------------------------------
+std::size_t StaticTileLayer::draw(RenderCommandList& commands, const sf::FloatRect& area) {
+    m_visibleChunks = 0;
+    m_visibleTiles = 0;
+    if (m_chunks.empty()) {
+        return 0;
+    }
+
+    // One extra column on each side covers tiles whose sprite overhangs its chunk
+    int firstColumn = static_cast<int>(std::floor(area.left / m_chunkWidth)) - 1;
+    int lastColumn = static_cast<int>(std::floor((area.left + area.width) / m_chunkWidth)) + 1;
+
+    std::size_t drawCalls = 0;
+    for (auto it = m_chunks.lower_bound(firstColumn); it != m_chunks.end() && it->first <= lastColumn; ++it) {
+        Chunk& chunk = it->second;
+        if (chunk.dirty) {
+            bake(chunk);
+        }
+        if (!chunk.bounds.intersects(area)) {
+            continue;
+        }
+
+        for (auto& part : chunk.parts) {
+            sf::RenderStates states;
+            states.texture = part.texture;
+            if (part.buffer) {
+                if (part.needsUpload) {
+                    commands.upload(part.buffer, part.vertices);
+                    part.needsUpload = false;
+                }
+                commands.draw(part.buffer, states);
+            }
+            else {
+                commands.draw(part.vertices, states);
+            }
+            ++drawCalls;
+        }
+        ++m_visibleChunks;
+        m_visibleTiles += chunk.tiles.size();
+    }
+    return drawCalls;
+}
+//-------------------------------------------------------------------------------------
@@ -0,0 +1,205 @@
+#include "VisibilityPolygon.h"
+#include <algorithm>
+#include <cmath>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+namespace {
+    constexpr float PI = static_cast<float>(M_PI);
+    constexpr float ANGLE_EPSILON = 1e-4f;     // Offset of the rays cast beside each corner
+    constexpr float SEGMENT_TOLERANCE = 1e-4f; // Slack on segment ends for rays grazing a corner
+    constexpr std::uint32_t NO_SEGMENT = 0xFFFFFFFF;
+}
+
+//-------------------------------------------------------------------------------------
+VisibilityPolygon::VisibilityPolygon(std::size_t arcSegments)
+    : m_arcSegments(std::max<std::size_t>(arcSegments, 8)) {
+}
+//-------------------------------------------------------------------------------------
+void VisibilityPolygon::setArcSegments(std::size_t arcSegments) {
+    m_arcSegments = std::max<std::size_t>(arcSegments, 8);
+}
+//-------------------------------------------------------------------------------------
+void VisibilityPolygon::begin(const sf::Vector2f& origin, float radius) {
+    m_origin = origin;
+    m_radius = radius;
+    m_segments.clear();
+    m_events.clear();
+    m_active.clear();
+    m_vertices.clear();
+}
+//-------------------------------------------------------------------------------------
+void VisibilityPolygon::addObstacle(const sf::FloatRect& bounds) {
+    float left = bounds.left;
+    float top = bounds.top;
+    float right = bounds.left + bounds.width;
+    float bottom = bounds.top + bounds.height;
+
+    // Outside the light circle
+    float closestX = std::clamp(m_origin.x, left, right);
+    float closestY = std::clamp(m_origin.y, top, bottom);
+    float dx = m_origin.x - closestX;
+    float dy = m_origin.y - closestY;
+    if (dx * dx + dy * dy > m_radius * m_radius) {
+        return;
+    }
+
+    // A light inside an obstacle is not shadowed by it
+    if (m_origin.x > left && m_origin.x < right && m_origin.y > top && m_origin.y < bottom) {
+        return;
+    }
+
+    // Only edges facing the light can be the first hit
+    if (m_origin.y < top)    addSegment({ left, top }, { right, top });
+    if (m_origin.y > bottom) addSegment({ right, bottom }, { left, bottom });
+    if (m_origin.x < left)   addSegment({ left, bottom }, { left, top });
+    if (m_origin.x > right)  addSegment({ right, top }, { right, bottom });
+}
+//-------------------------------------------------------------------------------------
+void VisibilityPolygon::addSegment(const sf::Vector2f& a, const sf::Vector2f& b) {
+    m_segments.push_back({ a, b });
+}
+//-------------------------------------------------------------------------------------
+float VisibilityPolygon::angleOf(const sf::Vector2f& point) const {
+    return std::atan2(point.y - m_origin.y, point.x - m_origin.x);
+}
+//-------------------------------------------------------------------------------------
+const std::vector<VisibilityPolygon::Vertex>& VisibilityPolygon::build() {
+    // Light boundary; offset by half a step so no corner sits on the +-PI seam
+    float step = 2.f * PI / static_cast<float>(m_arcSegments);
+    sf::Vector2f previous;
+    for (std::size_t i = 0; i <= m_arcSegments; ++i) {
+        float angle = (static_cast<float>(i) + 0.5f) * step;
+        sf::Vector2f point = m_origin + sf::Vector2f(std::cos(angle), std::sin(angle)) * m_radius;
+        if (i > 0) {
+            addSegment(previous, point);
+        }
+        previous = point;
+    }
+
+    // Each segment becomes active between its two endpoint angles. Segments
+    // spanning the seam start active and swap their begin/end events.
+    m_events.reserve(m_segments.size() * 2);
+    for (std::uint32_t i = 0; i < m_segments.size(); ++i) {
+        float angleA = angleOf(m_segments[i].a);
+        float angleB = angleOf(m_segments[i].b);
+        float low = std::min(angleA, angleB);
+        float high = std::max(angleA, angleB);
+
+        if (high - low > PI) {
+            m_active.push_back(i);
+            m_events.push_back({ low, i, false });
+            m_events.push_back({ high, i, true });
+        }
+        else {
+            m_events.push_back({ low, i, true });
+            m_events.push_back({ high, i, false });
+        }
+    }
+
+    std::sort(m_events.begin(), m_events.end(), [](const Event& lhs, const Event& rhs) {
+        return lhs.angle < rhs.angle;
+    });
+
+    m_vertices.reserve(m_events.size() * 2);
+    std::size_t index = 0;
+    float previousAngle = 0.f;
+    std::uint32_t previousSegment = NO_SEGMENT;
+    while (index < m_events.size()) {
+        float angle = m_events[index].angle;
+
+        // Just before the corner: the edges ending here still block the ray
+        Hit before = nearestHit(angle - ANGLE_EPSILON);
+        if (previousSegment != NO_SEGMENT) {
+            emitCrossing(previousAngle, previousSegment, angle - ANGLE_EPSILON, before.segment);
+        }
+        emit(angle - ANGLE_EPSILON, before.distance);
+
+        while (index < m_events.size() && m_events[index].angle - angle < ANGLE_EPSILON * 0.5f) {
+            const Event& event = m_events[index];
+            if (event.begins) {
+                m_active.push_back(event.segment);
+            }
+            else {
+                auto it = std::find(m_active.begin(), m_active.end(), event.segment);
+                if (it != m_active.end()) {
+                    *it = m_active.back();
+                    m_active.pop_back();
+                }
+            }
+            ++index;
+        }
+
+        // Just after the corner: the ray may now pass to a farther edge
+        Hit after = nearestHit(angle + ANGLE_EPSILON);
+        emit(angle + ANGLE_EPSILON, after.distance);
+        previousAngle = angle + ANGLE_EPSILON;
+        previousSegment = after.segment;
+    }
+
+    return m_vertices;
+}
+//-------------------------------------------------------------------------------------
+VisibilityPolygon::Hit VisibilityPolygon::nearestHit(float angle) const {
+    sf::Vector2f direction(std::cos(angle), std::sin(angle));
+    Hit hit{ m_radius, NO_SEGMENT };
+
+    for (std::uint32_t index : m_active) {
+        const Segment& segment = m_segments[index];
+        sf::Vector2f edge = segment.b - segment.a;
+        float denominator = direction.x * edge.y - direction.y * edge.x;
+        if (std::abs(denominator) < 1e-8f) {
+            continue;
+        }
+
+        sf::Vector2f toStart = segment.a - m_origin;
+        float t = (toStart.x * edge.y - toStart.y * edge.x) / denominator;
+        float u = (toStart.x * direction.y - toStart.y * direction.x) / denominator;
+        if (t >= 0.f && u >= -SEGMENT_TOLERANCE && u <= 1.f + SEGMENT_TOLERANCE && t < hit.distance) {
+            hit = { t, index };
+        }
+    }
+
+    return hit;
+}
+//-------------------------------------------------------------------------------------
+void VisibilityPolygon::emitCrossing(float fromAngle, std::uint32_t fromSegment,
+    float toAngle, std::uint32_t toSegment) {
+    // Overlapping obstacles have edges that cross between two events; the
+    // nearest edge then changes without a corner, so add the crossing point.
+    if (fromSegment == toSegment || fromSegment == NO_SEGMENT || toSegment == NO_SEGMENT) {
+        return;
+    }
+
+    const Segment& first = m_segments[fromSegment];
+    const Segment& second = m_segments[toSegment];
+    sf::Vector2f r = first.b - first.a;
+    sf::Vector2f q = second.b - second.a;
+    float denominator = r.x * q.y - r.y * q.x;
+    if (std::abs(denominator) < 1e-8f) {
+        return;
+    }
+
+    sf::Vector2f diff = second.a - first.a;
+    float t = (diff.x * q.y - diff.y * q.x) / denominator;
+    sf::Vector2f crossing = first.a + r * t;
+    float angle = angleOf(crossing);
+    if (angle > fromAngle && angle < toAngle) {
+        emit(angle, nearestHit(angle).distance);
+    }
+}
+//-------------------------------------------------------------------------------------
+void VisibilityPolygon::emit(float angle, float distance) {
+    sf::Vector2f point = m_origin + sf::Vector2f(std::cos(angle), std::sin(angle)) * distance;
+
+    if (!m_vertices.empty()) {
+        sf::Vector2f delta = point - m_vertices.back().point;
+        if (delta.x * delta.x + delta.y * delta.y < 0.01f) {
+            return;
+        }
+    }
+    m_vertices.push_back({ point, distance });
+}
+//-------------------------------------------------------------------------------------
@@ -1,5 +1,6 @@
 #include "GameOverScreen.h"
 #include "../Core/AudioManager.h"
+#include "RenderThread.h"
 #include <iostream>
 
 //-------------------------------------------------------------------------------------
@@ -7,6 +8,9 @@ GameOverScreen::GameOverScreen(const std::string& textureFile)
     : m_textureFile(textureFile) {}
 //-------------------------------------------------------------------------------------
 void GameOverScreen::show(sf::RenderWindow& window) {
+    // Takes the window from the render thread until the player dismisses the screen
+    RenderThread::ExclusiveAccess exclusiveAccess;
+
     AudioManager::instance().pauseMusic();
     AudioManager::instance().playSound("gameover");
 
@@ -0,0 +1,92 @@
+#include "HudCounter.h"
+#include "RenderThread.h"
+
+//-------------------------------------------------------------------------------------
+HudCounter::HudCounter(const sf::Font& font, unsigned int characterSize, const std::string& label)
+    : m_font(font), m_characterSize(characterSize), m_label(label, font, characterSize) {
+    // The label and the digits are drawn from glyphs cached here, never while recording
+    RenderThread::prepareGlyphs(m_font, m_characterSize);
+
+    // Preformatted strip of the only glyphs a number can use
+    for (std::size_t i = 0; i < m_strip.size(); ++i) {
+        sf::Uint32 codePoint = i < 10 ? static_cast<sf::Uint32>('0' + i) : static_cast<sf::Uint32>('-');
+        const sf::Glyph& glyph = m_font.getGlyph(codePoint, m_characterSize, false);
+        m_strip[i].bounds = glyph.bounds;
+        m_strip[i].texture = sf::FloatRect(glyph.textureRect);
+        m_strip[i].advance = glyph.advance;
+    }
+    setPosition({ 0.f, 0.f });
+}
+//-------------------------------------------------------------------------------------
+void HudCounter::setPosition(const sf::Vector2f& position) {
+    m_label.setPosition(position);
+
+    // Digits start where the label ends, on the label's baseline
+    float labelWidth = m_label.findCharacterPos(m_label.getString().getSize()).x - position.x;
+    m_digitsTransform = sf::Transform::Identity;
+    m_digitsTransform.translate(position.x + labelWidth, position.y + static_cast<float>(m_characterSize));
+}
+//-------------------------------------------------------------------------------------
+void HudCounter::setFillColor(const sf::Color& color) {
+    m_color = color;
+    m_label.setFillColor(color);
+    for (std::size_t i = 0; i < m_vertexCount; ++i) {
+        m_vertices[i].color = color;
+    }
+}
+//-------------------------------------------------------------------------------------
+bool HudCounter::setValue(int value) {
+    if (m_hasValue && value == m_value) {
+        return false;
+    }
+    m_value = value;
+    m_hasValue = true;
+    rebuildDigits();
+    return true;
+}
+//-------------------------------------------------------------------------------------
+void HudCounter::rebuildDigits() {
+    // Digits of |value|, least significant first, without string formatting
+    std::array<std::size_t, MAX_CHARS> indices{};
+    std::size_t count = 0;
+    long long magnitude = m_value < 0 ? -static_cast<long long>(m_value) : m_value;
+    do {
+        indices[count++] = static_cast<std::size_t>(magnitude % 10);
+        magnitude /= 10;
+    } while (magnitude > 0);
+    if (m_value < 0) {
+        indices[count++] = 10;
+    }
+
+    float x = 0.f;
+    m_vertexCount = 0;
+    for (std::size_t i = count; i-- > 0;) {
+        const Glyph& glyph = m_strip[indices[i]];
+        float left = x + glyph.bounds.left;
+        float top = glyph.bounds.top;
+        float right = left + glyph.bounds.width;
+        float bottom = top + glyph.bounds.height;
+        float u1 = glyph.texture.left;
+        float v1 = glyph.texture.top;
+        float u2 = u1 + glyph.texture.width;
+        float v2 = v1 + glyph.texture.height;
+
+        m_vertices[m_vertexCount++] = sf::Vertex({ left, top }, m_color, { u1, v1 });
+        m_vertices[m_vertexCount++] = sf::Vertex({ right, top }, m_color, { u2, v1 });
+        m_vertices[m_vertexCount++] = sf::Vertex({ left, bottom }, m_color, { u1, v2 });
+        m_vertices[m_vertexCount++] = sf::Vertex({ left, bottom }, m_color, { u1, v2 });
+        m_vertices[m_vertexCount++] = sf::Vertex({ right, top }, m_color, { u2, v1 });
+        m_vertices[m_vertexCount++] = sf::Vertex({ right, bottom }, m_color, { u2, v2 });
+        x += glyph.advance;
+    }
+}
+//-------------------------------------------------------------------------------------
+void HudCounter::draw(RenderCommandList& commands) const {
+    commands.draw(m_label);
+    if (m_vertexCount > 0) {
+        sf::RenderStates states(&m_font.getTexture(m_characterSize));
+        states.transform = m_digitsTransform;
+        commands.draw(m_vertices.data(), m_vertexCount, sf::Triangles, states);
+    }
+}
+//-------------------------------------------------------------------------------------
@@ -6,6 +6,7 @@
 #include <cmath>
 #include <sstream>
 #include "../Core/AudioManager.h"
+#include "RenderThread.h"
 
 //-------------------------------------------------------------------------------------
 SurpriseBoxScreen::SurpriseBoxScreen(sf::RenderWindow& window, TextureManagerType& textures)
@@ -115,6 +116,9 @@ SurpriseBoxScreen::SurpriseBoxScreen(sf::RenderWindow& window, TextureManagerTyp
 }
 //-------------------------------------------------------------------------------------
 SurpriseGiftType SurpriseBoxScreen::showSurpriseBox() {
+    // The sequence runs its own frame loop on this thread
+    RenderThread::ExclusiveAccess exclusiveAccess;
+
     m_isRunning = true;
     m_boxOpened = false;
     m_showingGift = false;
@@ -1,5 +1,7 @@
 ﻿#include "UIObserver.h"
+#include "RenderThread.h"
 #include <sstream>
+#include <cmath>
 
 //-------------------------------------------------------------------------------------
 UIObserver::UIObserver(sf::Font& font)
@@ -8,6 +10,9 @@ UIObserver::UIObserver(sf::Font& font)
     m_notificationText.setCharacterSize(30);
     m_notificationText.setOutlineThickness(2.0f);
     m_notificationText.setOutlineColor(sf::Color::Black);
+
+    // Notification strings are only known later; cache every glyph they can use
+    RenderThread::prepareGlyphs(m_notificationText);
 }
 //-------------------------------------------------------------------------------------
 UIObserver::~UIObserver() {
@@ -16,27 +21,28 @@ UIObserver::~UIObserver() {
 void UIObserver::initialize() {
     auto& eventSystem = EventSystem::getInstance();
 
-    // Subscribe to events
-    eventSystem.subscribe<ScoreChangedEvent>(
+    // Subscribe to events; the handles unsubscribe when this observer is destroyed
+    m_subscriptions.clear();
+    m_subscriptions.push_back(eventSystem.subscribe<ScoreChangedEvent>(
         [this](const ScoreChangedEvent& event) { onScoreChanged(event); }
-    );
+    ));
 
-    eventSystem.subscribe<ItemCollectedEvent>(
+    m_subscriptions.push_back(eventSystem.subscribe<ItemCollectedEvent>(
         [this](const ItemCollectedEvent& event) { onItemCollected(event); }
-    );
+    ));
 
-    eventSystem.subscribe<PlayerStateChangedEvent>(
+    m_subscriptions.push_back(eventSystem.subscribe<PlayerStateChangedEvent>(
         [this](const PlayerStateChangedEvent& event) { onPlayerStateChanged(event); }
-    );
+    ));
 
-    eventSystem.subscribe<EnemyKilledEvent>(
+    m_subscriptions.push_back(eventSystem.subscribe<EnemyKilledEvent>(
         [this](const EnemyKilledEvent& event) { onEnemyKilled(event); }
-    );
+    ));
 
-    eventSystem.subscribe<PlayerDiedEvent>(
+    m_subscriptions.push_back(eventSystem.subscribe<PlayerDiedEvent>(
         [this](const PlayerDiedEvent& ) {
         }
-    );
+    ));
 }
 //-------------------------------------------------------------------------------------
 void UIObserver::update(float dt) {
@@ -53,31 +59,25 @@ void UIObserver::update(float dt) {
     }
 }
 //-------------------------------------------------------------------------------------
-void UIObserver::render(sf::RenderWindow& window) {
+void UIObserver::render(RenderCommandList& commands, const sf::Vector2u& windowSize) {
     if (!m_notifications.empty()) {
         const auto& notification = m_notifications.front();
 
-        // Position at top center of screen
-        m_notificationText.setString(notification.text);
-        m_notificationText.setFillColor(notification.color);
-
-        // Center the text
-        sf::FloatRect bounds = m_notificationText.getLocalBounds();
-        m_notificationText.setOrigin(bounds.width / 2.f, bounds.height / 2.f);
-        m_notificationText.setPosition(window.getSize().x / 2.f, 100.f);
+        // Position at top center of screen (text and origin were laid out in addNotification)
+        m_notificationText.setPosition(windowSize.x / 2.f, 100.f);
 
-        // Fade out effect
+        // Fade out effect; only vertex colors change
         sf::Color color = notification.color;
         if (notification.lifetime < 0.5f) {
             color.a = static_cast<sf::Uint8>(255 * (notification.lifetime / 0.5f));
-            m_notificationText.setFillColor(color);
         }
+        m_notificationText.setFillColor(color);
 
         // Bounce effect
         float scale = 1.0f + 0.1f * std::sin(m_animationTimer * 10.0f);
         m_notificationText.setScale(scale, scale);
 
-        window.draw(m_notificationText);
+        commands.draw(m_notificationText);
     }
 }
 //-------------------------------------------------------------------------------------
@@ -127,5 +127,12 @@ void UIObserver::addNotification(const std::string& text, sf::Color color) {
 
     m_notifications.push(notif);
     m_animationTimer = 0.0f; // Reset animation
+
+    // Lay the text out once per notification instead of every frame
+    m_notificationText.setString(text);
+    m_notificationText.setFillColor(color);
+    m_notificationText.setScale(1.0f, 1.0f);
+    sf::FloatRect bounds = m_notificationText.getLocalBounds();
+    m_notificationText.setOrigin(bounds.width / 2.f, bounds.height / 2.f);
 }
 //-------------------------------------------------------------------------------------
\ No newline at end of file
@@ -1,5 +1,5 @@
 ﻿#include "UIOverlay.h"
-#include <sstream>
+#include <stdexcept>
 
 //-------------------------------------------------------------------------------------
 UIOverlay::UIOverlay(float windowWidth) {
@@ -7,21 +7,18 @@ UIOverlay::UIOverlay(float windowWidth) {
         throw std::runtime_error("Failed to load font");
     }
 
-    m_scoreText.setFont(m_font);
-    m_livesText.setFont(m_font);
-    m_timerText.setFont(m_font);
+    const sf::Color hudColor(150, 75, 20);
+    m_scoreCounter = std::make_unique<HudCounter>(m_font, 40, "Score: ");
+    m_livesCounter = std::make_unique<HudCounter>(m_font, 40, "Lives: ");
+    m_timerCounter = std::make_unique<HudCounter>(m_font, 40, "Time: ");
 
-    m_scoreText.setCharacterSize(40);
-    m_livesText.setCharacterSize(40);
-    m_timerText.setCharacterSize(40);
+    m_scoreCounter->setFillColor(hudColor);
+    m_livesCounter->setFillColor(hudColor);
+    m_timerCounter->setFillColor(hudColor);
 
-    m_scoreText.setFillColor(sf::Color(150, 75, 20));
-    m_livesText.setFillColor(sf::Color(150, 75, 20));
-    m_timerText.setFillColor(sf::Color(150, 75, 20));
-
-    m_scoreText.setPosition(20.f, 10.f);
-    m_livesText.setPosition(240.f, 10.f);
-    m_timerText.setPosition(440.f, 10.f);
+    m_scoreCounter->setPosition({ 20.f, 10.f });
+    m_livesCounter->setPosition({ 240.f, 10.f });
+    m_timerCounter->setPosition({ 440.f, 10.f });
 }
 //-------------------------------------------------------------------------------------
 void UIOverlay::handleEvent(const sf::Event& event, const sf::RenderWindow& window) {
@@ -32,21 +29,18 @@ void UIOverlay::handleEvent(const sf::Event& event, const sf::RenderWindow& wind
 }
 //-------------------------------------------------------------------------------------
 void UIOverlay::update(int score, int lives) {
-    m_scoreText.setString("Score: " + std::to_string(score));
-    m_livesText.setString("Lives: " + std::to_string(lives));
-
-    std::ostringstream oss;
-    oss << "Time: " << static_cast<int>(m_timer.getElapsedTime().asSeconds());
-    m_timerText.setString(oss.str());
+    // Counters ignore unchanged values, so a steady HUD costs nothing here
+    m_scoreCounter->setValue(score);
+    m_livesCounter->setValue(lives);
+    m_timerCounter->setValue(static_cast<int>(m_timer.getElapsedTime().asSeconds()));
 }
 //-------------------------------------------------------------------------------------
-void UIOverlay::draw(sf::RenderWindow& window) {
-    sf::View uiView = window.getDefaultView();
-    window.setView(uiView);
+void UIOverlay::draw(RenderCommandList& commands, const sf::View& screenView) {
+    commands.setView(screenView);
 
-    window.draw(m_scoreText);
-    window.draw(m_livesText);
-    window.draw(m_timerText);
+    m_scoreCounter->draw(commands);
+    m_livesCounter->draw(commands);
+    m_timerCounter->draw(commands);
 }
 //-------------------------------------------------------------------------------------
 void UIOverlay::reset() {
@@ -1,6 +1,7 @@
 #include "WinningScreen.h"
 #include <iostream>
 #include "../Core/AudioManager.h"
+#include "RenderThread.h"
 
 //-------------------------------------------------------------------------------------
 WinningScreen::WinningScreen(const std::string& textureFile)
@@ -8,6 +9,9 @@ WinningScreen::WinningScreen(const std::string& textureFile)
 }
 //-------------------------------------------------------------------------------------
 void WinningScreen::show(sf::RenderWindow& window) {
+    // Draws and polls the window itself
+    RenderThread::ExclusiveAccess exclusiveAccess;
+
     AudioManager::instance().pauseMusic();
     AudioManager::instance().playSound("win");
 
@@ -0,0 +1,183 @@
+#include "CompiledLevel.h"
+#include <algorithm>
+#include <array>
+#include <cstring>
+
+namespace {
+    constexpr std::size_t MAX_LITERAL = 128;
+    constexpr std::size_t MIN_REPEAT = 3;
+    constexpr std::size_t MAX_REPEAT = 130;
+    constexpr std::uint8_t REPEAT_BIAS = 125;   // Control byte = repeat length + bias
+
+    template<typename T>
+    void put(std::vector<std::uint8_t>& out, std::size_t at, T value) {
+        std::memcpy(out.data() + at, &value, sizeof(T));
+    }
+
+    template<typename T>
+    T get(const std::uint8_t* in) {
+        T value;
+        std::memcpy(&value, in, sizeof(T));
+        return value;
+    }
+
+    std::size_t lineWidth(const std::string& line) {
+        return !line.empty() && line.back() == '\r' ? line.size() - 1 : line.size();
+    }
+
+    // Calls visit(tile, count) for each run of the packed grid; stops at a truncated run
+    template<typename Visit>
+    void unpack(const std::uint8_t* grid, std::size_t bytes, Visit visit) {
+        std::size_t at = 0;
+        while (at < bytes) {
+            const std::uint8_t control = grid[at++];
+            if (control < MAX_LITERAL) {
+                const std::size_t count = std::min<std::size_t>(control + 1u, bytes - at);
+                for (std::size_t i = 0; i < count; ++i) {
+                    visit(static_cast<char>(grid[at + i]), std::size_t{ 1 });
+                }
+                at += count;
+            }
+            else if (at < bytes) {
+                visit(static_cast<char>(grid[at++]), static_cast<std::size_t>(control - REPEAT_BIAS));
+            }
+        }
+    }
+}
+
+//-------------------------------------------------------------------------------------
+bool CompiledLevel::isSpawnChar(char c) {
+    // Every character LevelLoader::createEntityForChar turns into an entity
+    static const std::array<bool, 256> table = [] {
+        std::array<bool, 256> spawns{};
+        for (const char* p = "GLERMSBXcCshprw*mzZFW"; *p; ++p) {
+            spawns[static_cast<unsigned char>(*p)] = true;
+        }
+        return spawns;
+    }();
+    return table[static_cast<unsigned char>(c)];
+}
+//-------------------------------------------------------------------------------------
+std::vector<std::uint8_t> CompiledLevel::compile(const std::vector<std::string>& lines) {
+    std::size_t width = 0;
+    for (const auto& line : lines) {
+        width = std::max(width, lineWidth(line));
+    }
+    const std::size_t height = lines.size();
+    if (height > 0xFFFF) {
+        return {};  // Rows are stored as u16
+    }
+
+    std::string tiles;
+    tiles.reserve(width * height);
+    std::size_t spawnCount = 0;
+    for (const auto& line : lines) {
+        const std::size_t used = lineWidth(line);
+        for (std::size_t column = 0; column < width; ++column) {
+            const char c = column < used ? line[column] : EMPTY_TILE;
+            spawnCount += isSpawnChar(c) ? 1u : 0u;
+            tiles.push_back(c);
+        }
+    }
+
+    std::vector<std::uint8_t> out(HEADER_SIZE, 0);
+    std::size_t literalStart = 0;
+    auto flushLiterals = [&](std::size_t end) {
+        while (literalStart < end) {
+            const std::size_t count = std::min(MAX_LITERAL, end - literalStart);
+            out.push_back(static_cast<std::uint8_t>(count - 1));
+            out.insert(out.end(), tiles.begin() + static_cast<std::ptrdiff_t>(literalStart),
+                tiles.begin() + static_cast<std::ptrdiff_t>(literalStart + count));
+            literalStart += count;
+        }
+    };
+    std::size_t at = 0;
+    while (at < tiles.size()) {
+        std::size_t run = 1;
+        while (at + run < tiles.size() && tiles[at + run] == tiles[at] && run < MAX_REPEAT) {
+            ++run;
+        }
+        if (run >= MIN_REPEAT) {
+            flushLiterals(at);
+            out.push_back(static_cast<std::uint8_t>(run + REPEAT_BIAS));
+            out.push_back(static_cast<std::uint8_t>(tiles[at]));
+            literalStart = at + run;
+        }
+        at += run;
+    }
+    flushLiterals(tiles.size());
+
+    std::memcpy(out.data(), MAGIC, 4);
+    put<std::uint16_t>(out, 4, VERSION);
+    put<std::uint16_t>(out, 6, 0);
+    put<std::uint32_t>(out, 8, static_cast<std::uint32_t>(width));
+    put<std::uint32_t>(out, 12, static_cast<std::uint32_t>(height));
+    put<std::uint32_t>(out, 16, static_cast<std::uint32_t>(spawnCount));
+    put<std::uint32_t>(out, 20, static_cast<std::uint32_t>(HEADER_SIZE));
+    put<std::uint32_t>(out, 24, static_cast<std::uint32_t>(out.size() - HEADER_SIZE));
+    put<std::uint32_t>(out, 28, 0);
+    return out;
+}
+//-------------------------------------------------------------------------------------
+bool CompiledLevel::open(const std::string& path) {
+    m_grid = nullptr;
+    m_spawnCount = m_gridBytes = 0;
+    if (!m_file.openRead(path)) {
+        return false;
+    }
+
+    const std::uint8_t* data = m_file.data();
+    const std::size_t size = m_file.size();
+    if (size < HEADER_SIZE || std::memcmp(data, MAGIC, 4) != 0 || get<std::uint16_t>(data + 4) != VERSION) {
+        m_file.close();
+        return false;
+    }
+
+    m_width = get<std::uint32_t>(data + 8);
+    m_height = get<std::uint32_t>(data + 12);
+    const std::size_t spawnCount = get<std::uint32_t>(data + 16);
+    const std::size_t gridOffset = get<std::uint32_t>(data + 20);
+    const std::size_t gridBytes = get<std::uint32_t>(data + 24);
+    if (gridOffset + gridBytes > size) {
+        m_file.close();
+        return false;
+    }
+
+    m_spawnCount = spawnCount;
+    m_grid = data + gridOffset;
+    m_gridBytes = gridBytes;
+    return true;
+}
+//-------------------------------------------------------------------------------------
+void CompiledLevel::decodeSpawns(std::vector<Spawn>& out) const {
+    if (m_width == 0) {
+        return;
+    }
+    out.reserve(out.size() + m_spawnCount);
+
+    std::size_t tile = 0;
+    unpack(m_grid, m_gridBytes, [&](char c, std::size_t count) {
+        if (isSpawnChar(c)) {
+            for (std::size_t i = tile; i < tile + count; ++i) {
+                out.push_back({ c, static_cast<std::uint16_t>(i / m_width), static_cast<std::uint32_t>(i % m_width) });
+            }
+        }
+        tile += count;
+    });
+}
+//-------------------------------------------------------------------------------------
+std::vector<std::string> CompiledLevel::decodeGrid() const {
+    std::string tiles;
+    tiles.reserve(static_cast<std::size_t>(m_width) * m_height);
+    unpack(m_grid, m_gridBytes, [&](char c, std::size_t count) {
+        tiles.append(count, c);
+    });
+
+    std::vector<std::string> rows;
+    for (std::uint32_t row = 0; row < m_height && m_width > 0; ++row) {
+        std::size_t start = static_cast<std::size_t>(row) * m_width;
+        rows.push_back(start < tiles.size() ? tiles.substr(start, m_width) : std::string());
+    }
+    return rows;
+}
+//-------------------------------------------------------------------------------------
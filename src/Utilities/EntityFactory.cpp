@@ -8,22 +8,42 @@ EntityFactory& EntityFactory::instance() {
 }
 //-------------------------------------------------------------------------------------
 void EntityFactory::registerCreator(const std::string& typeName, CreatorFunc creator) {
+    if (typeName.size() == 1) {
+        registerCreator(typeName[0], std::move(creator));
+        return;
+    }
     if (m_creators.find(typeName) != m_creators.end()) {
         std::cerr << "Warning: Overwriting creator for type: " << typeName << std::endl;
     }
     m_creators[typeName] = creator;
 }
 //-------------------------------------------------------------------------------------
+void EntityFactory::registerCreator(char tileChar, CreatorFunc creator) {
+    CreatorFunc& slot = m_tileCreators[static_cast<unsigned char>(tileChar)];
+    if (slot) {
+        std::cerr << "Warning: Overwriting creator for type: " << tileChar << std::endl;
+    }
+    slot = std::move(creator);
+}
+//-------------------------------------------------------------------------------------
 std::unique_ptr<Entity> EntityFactory::create(const std::string& typeName, float x, float y) {
-    auto it = m_creators.find(typeName);
-    if (it != m_creators.end()) {
-        return it->second(x, y);
+    if (const CreatorFunc* creator = findCreator(typeName)) {
+        return (*creator)(x, y);
     }
     
     std::cerr << "Error: No creator registered for type: " << typeName << std::endl;
     return nullptr;
 }
 //-------------------------------------------------------------------------------------
+std::unique_ptr<Entity> EntityFactory::create(char tileChar, float x, float y) {
+    if (const CreatorFunc* creator = findCreator(tileChar)) {
+        return (*creator)(x, y);
+    }
+
+    std::cerr << "Error: No creator registered for type: " << tileChar << std::endl;
+    return nullptr;
+}
+//-------------------------------------------------------------------------------------
 Entity* EntityFactory::createInManager(const std::string& typeName, float x, float y, EntityManager&) {
     auto entity = create(typeName, x, y);
     if (entity) {
@@ -33,7 +53,20 @@ Entity* EntityFactory::createInManager(const std::string& typeName, float x, flo
     return nullptr;
 }
 //-------------------------------------------------------------------------------------
+const EntityFactory::CreatorFunc* EntityFactory::findCreator(const std::string& typeName) const {
+    if (typeName.size() == 1) {
+        return findCreator(typeName[0]);
+    }
+    auto it = m_creators.find(typeName);
+    return it != m_creators.end() ? &it->second : nullptr;
+}
+//-------------------------------------------------------------------------------------
+const EntityFactory::CreatorFunc* EntityFactory::findCreator(char tileChar) const {
+    const CreatorFunc& creator = m_tileCreators[static_cast<unsigned char>(tileChar)];
+    return creator ? &creator : nullptr;
+}
+//-------------------------------------------------------------------------------------
 bool EntityFactory::hasCreator(const std::string& typeName) const {
-    return m_creators.find(typeName) != m_creators.end();
+    return findCreator(typeName) != nullptr;
 }
 //-------------------------------------------------------------------------------------
\ No newline at end of file
@@ -0,0 +1,106 @@
+#include "JobSystem.h"
+#include <algorithm>
+
+//-------------------------------------------------------------------------------------
+JobSystem& JobSystem::instance() {
+    static JobSystem jobs;
+    return jobs;
+}
+//-------------------------------------------------------------------------------------
+JobSystem::JobSystem() {
+    // Leave one core for the main thread, which also takes part in every job
+    unsigned int cores = std::max(1u, std::thread::hardware_concurrency());
+    std::size_t workerCount = cores > 1 ? cores - 1 : 0;
+
+    m_workers.reserve(workerCount);
+    for (std::size_t i = 0; i < workerCount; ++i) {
+        m_workers.emplace_back(&JobSystem::workerLoop, this);
+    }
+}
+//-------------------------------------------------------------------------------------
+JobSystem::~JobSystem() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopping = true;
+    }
+    m_wake.notify_all();
+    for (auto& worker : m_workers) {
+        worker.join();
+    }
+}
+//-------------------------------------------------------------------------------------
+void JobSystem::parallelFor(std::size_t count, const std::function<void(std::size_t)>& job) {
+    if (count == 0) {
+        return;
+    }
+    if (count == 1 || m_workers.empty()) {
+        for (std::size_t i = 0; i < count; ++i) {
+            job(i);
+        }
+        return;
+    }
+
+    std::lock_guard<std::mutex> submit(m_submitMutex);
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_job = &job;
+        m_count = count;
+        m_next.store(0);
+        m_remaining = count;
+        ++m_generation;
+    }
+    m_wake.notify_all();
+
+    runIndices(job, count);
+
+    // Also wait for late workers to leave, so the next job cannot reach them
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_finished.wait(lock, [this] { return m_remaining == 0 && m_busyWorkers == 0; });
+    m_job = nullptr;
+}
+//-------------------------------------------------------------------------------------
+std::size_t JobSystem::runIndices(const std::function<void(std::size_t)>& job, std::size_t count) {
+    std::size_t done = 0;
+    for (std::size_t i = m_next.fetch_add(1); i < count; i = m_next.fetch_add(1)) {
+        job(i);
+        ++done;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_remaining -= done;
+    if (m_remaining == 0) {
+        m_finished.notify_all();
+    }
+    return done;
+}
+//-------------------------------------------------------------------------------------
+void JobSystem::workerLoop() {
+    std::size_t seenGeneration = 0;
+    while (true) {
+        const std::function<void(std::size_t)>* job = nullptr;
+        std::size_t count = 0;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_wake.wait(lock, [&] { return m_stopping || m_generation != seenGeneration; });
+            if (m_stopping) {
+                return;
+            }
+            seenGeneration = m_generation;
+            if (m_job == nullptr) {
+                continue;
+            }
+            job = m_job;
+            count = m_count;
+            ++m_busyWorkers;
+        }
+
+        runIndices(*job, count);
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        --m_busyWorkers;
+        if (m_busyWorkers == 0) {
+            m_finished.notify_all();
+        }
+    }
+}
+//-------------------------------------------------------------------------------------
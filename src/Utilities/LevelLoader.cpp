@@ -2,6 +2,10 @@
 #include "EntityManager.h"
 #include "EntityFactory.h"
 #include "Constants.h"
+#include "CompiledLevel.h"
+#include <algorithm>
+#include <array>
+#include <filesystem>
 #include <fstream>
 #include <iostream>
 #include "WellEntity.h"
@@ -13,6 +17,17 @@ bool LevelLoader::loadFromFile(const std::string& path,
     b2World& world,
     TextureManager& textures) {
 
+    const std::string compiledPath = findCompiledLevel(path);
+    if (!compiledPath.empty()) {
+        CompiledLevel level;
+        if (level.open(compiledPath)) {
+            entityManager.clear();
+            spawnCompiled(level, entityManager);
+            return true;
+        }
+        std::cerr << "[LevelLoader] " << compiledPath << " is not a valid compiled level" << std::endl;
+    }
+
     std::vector<std::string> lines = readLevelFile(path);
     if (lines.empty()) {
         return false;
@@ -37,75 +52,101 @@ bool LevelLoader::loadFromFile(const std::string& path,
     return true;
 }
 //-------------------------------------------------------------------------------------
-std::unique_ptr<Entity> LevelLoader::createEntityForChar(char tileChar, float x, float y,
-    b2World& , TextureManager& ) {
+std::string LevelLoader::findCompiledLevel(const std::string& path) const {
+    namespace fs = std::filesystem;
+    std::error_code error;
+
+    fs::path source(path);
+    if (source.extension() == ".lvlb") {
+        return path;
+    }
+
+    fs::path compiled = source;
+    compiled.replace_extension(".lvlb");
+    if (!fs::exists(compiled, error)) {
+        return {};
+    }
 
+    // A text level edited after compiling wins over its stale binary
+    if (fs::exists(source, error) && fs::last_write_time(source, error) > fs::last_write_time(compiled, error)) {
+        return {};
+    }
+    return compiled.string();
+}
+//-------------------------------------------------------------------------------------
+void LevelLoader::spawnCompiled(const CompiledLevel& level, EntityManager& entityManager) const {
     EntityFactory& factory = EntityFactory::instance();
+    std::vector<CompiledLevel::Spawn> spawns;
+    level.decodeSpawns(spawns);
+
+    // Row by row, like the text path, so entity ids and creation order match it
+    std::array<bool, 256> reported{};
+    for (const CompiledLevel::Spawn& spawn : spawns) {
+        const EntityFactory::CreatorFunc* creator = factory.findCreator(spawn.type);
+        if (!creator) {
+            bool& seen = reported[static_cast<unsigned char>(spawn.type)];
+            if (!seen) {
+                std::cerr << "Error: No creator registered for type: " << spawn.type << std::endl;
+                seen = true;
+            }
+            continue;
+        }
+        sf::Vector2f pos = spawnPosition(spawn);
+        if (auto entity = (*creator)(pos.x, pos.y)) {
+            entityManager.addEntity(std::move(entity));
+        }
+    }
+}
+//-------------------------------------------------------------------------------------
+bool LevelLoader::readSpawns(const std::string& path, std::vector<CompiledLevel::Spawn>& spawns) const {
+    spawns.clear();
 
-    switch (tileChar) {
-        // Collectibles and entities
-    case 'C': // Coin
-        return factory.create("C", x + TILE_SIZE / 4.f, y + TILE_SIZE / 4.f);
-
-    case 'z': // Square Enemy
-        return factory.create("z", x, y);
-
-    case 'Z': // Smart Enemy
-        return factory.create("Z", x, y);
-
-    case 'F': // Falcon Enemy
-        return factory.create("F", x, y);
-
-    case 's': // Speed Gift
-        return factory.create("s", x, y);
-
-    case 'h': // Life Heart Gift
-        return factory.create("h", x, y);
-
-    case 'W': // Well
-        return factory.create("W", x, y);
-
-    case 'r': // Reverse Movement Gift
-        return factory.create("r", x, y);
-
-    case 'p': // Protective Shield Gift
-        return factory.create("p", x, y);
-
-    case 'w': // Headwind Storm Gift
-        return factory.create("w", x, y);
-
-    case '*': // Rare Coin Gift
-        return factory.create("*", x, y);
-
-    case 'm': // Magnetic Gift
-        return factory.create("m", x, y);
-    case 'G': // Ground
-        return factory.create("G", x, y);
-    case 'L': // Left ground
-        return factory.create("L", x, y);
-    case 'R': // Right ground
-        return factory.create("R", x, y);
-    case 'M': // Middle ground
-        return factory.create("M", x, y);
-    case 'E': // Edge
-        return factory.create("E", x, y);
-    case 'B': // Box
-        return factory.create("B", x, y);
-    case 'S': // Sea
-        return factory.create("S", x, y);
-    case 'X': // Flag
-        return factory.create("X", x, y);
-    case 'c': // Cactus
-        return factory.create("c", x, y);
-
-    case ' ':
-    case '-':
-        // Empty space
-        return nullptr;
+    CompiledLevel level;
+    const std::string compiledPath = findCompiledLevel(path);
+    if (!compiledPath.empty() && level.open(compiledPath)) {
+        level.decodeSpawns(spawns);
+    }
+    else {
+        std::vector<std::string> lines = readLevelFile(path);
+        if (lines.empty()) {
+            return false;
+        }
+        for (std::size_t row = 0; row < lines.size() && row <= 0xFFFF; ++row) {
+            const std::string& line = lines[row];
+            for (std::size_t column = 0; column < line.size(); ++column) {
+                if (CompiledLevel::isSpawnChar(line[column])) {
+                    spawns.push_back({ line[column], static_cast<std::uint16_t>(row), static_cast<std::uint32_t>(column) });
+                }
+            }
+        }
+    }
 
-    default:
+    std::stable_sort(spawns.begin(), spawns.end(), [](const CompiledLevel::Spawn& a, const CompiledLevel::Spawn& b) {
+        return a.column < b.column;
+    });
+    return true;
+}
+//-------------------------------------------------------------------------------------
+sf::Vector2f LevelLoader::spawnPosition(const CompiledLevel::Spawn& spawn) const {
+    return calculatePosition(static_cast<int>(spawn.column), spawn.row) + spawnOffset(spawn.type);
+}
+//-------------------------------------------------------------------------------------
+sf::Vector2f LevelLoader::spawnOffset(char tileChar) const {
+    // Coins sit inside their tile
+    return tileChar == 'C' ? sf::Vector2f(TILE_SIZE / 4.f, TILE_SIZE / 4.f) : sf::Vector2f(0.f, 0.f);
+}
+//-------------------------------------------------------------------------------------
+std::unique_ptr<Entity> LevelLoader::createEntityForChar(char tileChar, float x, float y,
+    b2World& , TextureManager& ) {
+
+    // One table read per tile; unregistered and empty characters spawn nothing
+    const EntityFactory::CreatorFunc* creator = EntityFactory::instance().findCreator(tileChar);
+    if (!creator) {
         return nullptr;
     }
+
+    const sf::Vector2f offset = spawnOffset(tileChar);
+    return (*creator)(x + offset.x, y + offset.y);
 }
 //-------------------------------------------------------------------------------------
 std::vector<std::string> LevelLoader::readLevelFile(const std::string& path) const {
@@ -0,0 +1,194 @@
+#include "MappedFile.h"
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+//-------------------------------------------------------------------------------------
+MappedFile::~MappedFile() {
+    close();
+}
+//-------------------------------------------------------------------------------------
+#ifdef _WIN32
+
+bool MappedFile::openRead(const std::string& path) {
+    close();
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+        OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size) || size.QuadPart == 0) {
+        CloseHandle(file);
+        return false;
+    }
+    m_file = file;
+    m_writable = false;
+    if (!map(static_cast<std::size_t>(size.QuadPart))) {
+        close();
+        return false;
+    }
+    return true;
+}
+//-------------------------------------------------------------------------------------
+bool MappedFile::create(const std::string& path, std::size_t size) {
+    close();
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, nullptr,
+        CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+    m_file = file;
+    m_writable = true;
+    if (!map(size)) {
+        close();
+        return false;
+    }
+    return true;
+}
+//-------------------------------------------------------------------------------------
+bool MappedFile::map(std::size_t size) {
+    // A writable mapping larger than the file extends the file
+    const DWORD protect = m_writable ? PAGE_READWRITE : PAGE_READONLY;
+    const std::uint64_t size64 = size;
+    m_mapping = CreateFileMappingA(static_cast<HANDLE>(m_file), nullptr, protect,
+        static_cast<DWORD>(size64 >> 32), static_cast<DWORD>(size64 & 0xFFFFFFFFu), nullptr);
+    if (!m_mapping) {
+        return false;
+    }
+    void* view = MapViewOfFile(static_cast<HANDLE>(m_mapping), m_writable ? FILE_MAP_WRITE : FILE_MAP_READ, 0, 0, size);
+    if (!view) {
+        CloseHandle(static_cast<HANDLE>(m_mapping));
+        m_mapping = nullptr;
+        return false;
+    }
+    m_data = static_cast<std::uint8_t*>(view);
+    m_size = size;
+    return true;
+}
+//-------------------------------------------------------------------------------------
+void MappedFile::unmap() {
+    if (m_data) {
+        UnmapViewOfFile(m_data);
+        m_data = nullptr;
+    }
+    if (m_mapping) {
+        CloseHandle(static_cast<HANDLE>(m_mapping));
+        m_mapping = nullptr;
+    }
+    m_size = 0;
+}
+//-------------------------------------------------------------------------------------
+void MappedFile::close(std::size_t usedSize) {
+    const std::size_t mappedSize = m_size;
+    unmap();
+    if (!m_file) {
+        return;
+    }
+    if (m_writable && usedSize < mappedSize) {
+        LARGE_INTEGER end;
+        end.QuadPart = static_cast<LONGLONG>(usedSize);
+        SetFilePointerEx(static_cast<HANDLE>(m_file), end, nullptr, FILE_BEGIN);
+        SetEndOfFile(static_cast<HANDLE>(m_file));
+    }
+    CloseHandle(static_cast<HANDLE>(m_file));
+    m_file = nullptr;
+}
+
+#else
+
+bool MappedFile::openRead(const std::string& path) {
+    close();
+    int file = ::open(path.c_str(), O_RDONLY);
+    if (file < 0) {
+        return false;
+    }
+    struct stat info;
+    if (fstat(file, &info) != 0 || info.st_size == 0) {
+        ::close(file);
+        return false;
+    }
+    m_file = file;
+    m_writable = false;
+    if (!map(static_cast<std::size_t>(info.st_size))) {
+        close();
+        return false;
+    }
+    return true;
+}
+//-------------------------------------------------------------------------------------
+bool MappedFile::create(const std::string& path, std::size_t size) {
+    close();
+    int file = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (file < 0) {
+        return false;
+    }
+    m_file = file;
+    m_writable = true;
+    if (ftruncate(m_file, static_cast<off_t>(size)) != 0 || !map(size)) {
+        close();
+        return false;
+    }
+    return true;
+}
+//-------------------------------------------------------------------------------------
+bool MappedFile::map(std::size_t size) {
+    const int protect = m_writable ? PROT_READ | PROT_WRITE : PROT_READ;
+    void* view = mmap(nullptr, size, protect, MAP_SHARED, m_file, 0);
+    if (view == MAP_FAILED) {
+        return false;
+    }
+    m_data = static_cast<std::uint8_t*>(view);
+    m_size = size;
+    return true;
+}
+//-------------------------------------------------------------------------------------
+void MappedFile::unmap() {
+    if (m_data) {
+        munmap(m_data, m_size);
+        m_data = nullptr;
+    }
+    m_size = 0;
+}
+//-------------------------------------------------------------------------------------
+void MappedFile::close(std::size_t usedSize) {
+    const std::size_t mappedSize = m_size;
+    unmap();
+    if (m_file < 0) {
+        return;
+    }
+    // On failure the file keeps its zero-filled tail
+    if (m_writable && usedSize < mappedSize && ftruncate(m_file, static_cast<off_t>(usedSize)) != 0) {
+        m_writable = false;
+    }
+    ::close(m_file);
+    m_file = -1;
+}
+
+#endif
+//-------------------------------------------------------------------------------------
+bool MappedFile::resize(std::size_t size) {
+    if (!m_writable || !isOpen()) {
+        return false;
+    }
+    if (size <= m_size) {
+        return true;
+    }
+
+    unmap();
+#ifndef _WIN32
+    if (ftruncate(m_file, static_cast<off_t>(size)) != 0) {
+        return false;
+    }
+#endif
+    return map(size);
+}
+//-------------------------------------------------------------------------------------
@@ -0,0 +1,322 @@
+#include "TextureAtlas.h"
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+
+//-------------------------------------------------------------------------------------
+TextureAtlas& TextureAtlas::instance() {
+    static TextureAtlas atlas;
+    return atlas;
+}
+//-------------------------------------------------------------------------------------
+const std::vector<std::string>& TextureAtlas::gameplayTextures() {
+    // Names must match the spelling used by the entity code, since the
+    // TextureManager caches by the exact requested string.
+    static const std::vector<std::string> names = {
+        "middle.png", "left.png", "right.png", "Edge.png", "Sea.png",
+        "cactus.png", "wooden_box.png", "well.png", "redflag.png",
+        "Coin.png", "NormalBall.png", "TransparentBall.png", "MagneticBall.png",
+        "SquareEnemy.png", "SquareEnemy2.png", "FalconEnemy.png", "FalconEnemy2.png",
+        "Bullet.png", "LifeHeartGift.png", "SpeedGift.png", "ProtectiveShieldGift.png",
+        "RareCoinGift.png", "ReverseMovementGift.png", "HeadwindStormGift.png", "MagneticGift.png"
+    };
+    return names;
+}
+//-------------------------------------------------------------------------------------
+bool TextureAtlas::build(TextureManager& textures, const std::vector<std::string>& filenames,
+    const std::string& cachePath) {
+    clear();
+
+    std::vector<PackedEntry> entries;
+    std::vector<sf::Image> pageImages;
+    bool fromCache = !cachePath.empty() && loadCache(cachePath, filenames, entries, pageImages);
+    if (fromCache) {
+        adoptSources(textures, entries, pageImages);
+    }
+    else {
+        entries.clear();
+        pageImages.clear();
+        m_pages.clear();
+
+        if (!pack(textures, filenames, entries, pageImages) || !uploadPages(pageImages)) {
+            m_pages.clear();
+            return false;
+        }
+        if (!cachePath.empty()) {
+            saveCache(cachePath, filenames, entries, pageImages);
+        }
+    }
+
+    for (const auto& entry : entries) {
+        try {
+            const sf::Texture& source = textures.getResource(entry.filename);
+            m_regions[&source] = Region{ m_pages[entry.page].get(), entry.rect };
+        }
+        catch (const std::exception& e) {
+            std::cerr << "[TextureAtlas] Skipping " << entry.filename << ": " << e.what() << std::endl;
+        }
+    }
+
+    std::cout << "[TextureAtlas] Packed " << m_regions.size() << " textures into "
+              << m_pages.size() << " page(s)" << (fromCache ? " (from cache)" : "") << std::endl;
+    return !m_regions.empty();
+}
+//-------------------------------------------------------------------------------------
+bool TextureAtlas::pack(TextureManager& textures, const std::vector<std::string>& filenames,
+    std::vector<PackedEntry>& entries, std::vector<sf::Image>& pageImages) {
+    unsigned pageSize = std::min(sf::Texture::getMaximumSize(), MAX_PAGE_SIZE);
+
+    struct Source {
+        std::string filename;
+        sf::Image image;
+    };
+    std::vector<Source> sources;
+    sources.reserve(filenames.size());
+
+    for (const auto& name : filenames) {
+        try {
+            const sf::Texture& texture = textures.getResource(name);
+            sf::Vector2u size = texture.getSize();
+            if (size.x + 2 * EXTRUDE + PADDING > pageSize || size.y + 2 * EXTRUDE + PADDING > pageSize) {
+                std::cout << "[TextureAtlas] " << name << " is larger than an atlas page, left unpacked" << std::endl;
+                continue;
+            }
+            sources.push_back({ name, texture.copyToImage() });
+        }
+        catch (const std::exception& e) {
+            std::cerr << "[TextureAtlas] Skipping " << name << ": " << e.what() << std::endl;
+        }
+    }
+
+    if (sources.empty()) {
+        return false;
+    }
+
+    // Shelf packing: tallest images first, left to right, new shelf when a row is full
+    std::stable_sort(sources.begin(), sources.end(), [](const Source& a, const Source& b) {
+        return a.image.getSize().y > b.image.getSize().y;
+    });
+
+    std::vector<sf::Image> fullPages;
+    std::vector<unsigned> pageHeights;
+    unsigned cursorX = 0;
+    unsigned cursorY = 0;
+    unsigned shelfHeight = 0;
+
+    auto newPage = [&]() {
+        fullPages.emplace_back();
+        fullPages.back().create(pageSize, pageSize, sf::Color::Transparent);
+        pageHeights.push_back(0);
+        cursorX = 0;
+        cursorY = 0;
+        shelfHeight = 0;
+    };
+    newPage();
+
+    for (const auto& source : sources) {
+        sf::Vector2u size = source.image.getSize();
+        unsigned width = size.x + 2 * EXTRUDE + PADDING;
+        unsigned height = size.y + 2 * EXTRUDE + PADDING;
+
+        if (cursorX + width > pageSize) {
+            cursorX = 0;
+            cursorY += shelfHeight;
+            shelfHeight = 0;
+        }
+        if (cursorY + height > pageSize) {
+            newPage();
+        }
+
+        sf::IntRect rect(static_cast<int>(cursorX + EXTRUDE), static_cast<int>(cursorY + EXTRUDE),
+            static_cast<int>(size.x), static_cast<int>(size.y));
+        fullPages.back().copy(source.image, cursorX + EXTRUDE, cursorY + EXTRUDE);
+        extrude(fullPages.back(), rect);
+        entries.push_back({ source.filename, fullPages.size() - 1, rect });
+
+        cursorX += width;
+        shelfHeight = std::max(shelfHeight, height);
+        pageHeights.back() = std::max(pageHeights.back(), cursorY + shelfHeight);
+    }
+
+    // Trim unused rows at the bottom of each page
+    pageImages.clear();
+    for (std::size_t i = 0; i < fullPages.size(); ++i) {
+        pageImages.emplace_back();
+        pageImages.back().create(pageSize, pageHeights[i], sf::Color::Transparent);
+        pageImages.back().copy(fullPages[i], 0, 0,
+            sf::IntRect(0, 0, static_cast<int>(pageSize), static_cast<int>(pageHeights[i])));
+    }
+    return true;
+}
+//-------------------------------------------------------------------------------------
+void TextureAtlas::extrude(sf::Image& page, const sf::IntRect& rect) {
+    // Repeat the outermost rows and columns (corners included) one pixel outwards
+    const int extrude = static_cast<int>(EXTRUDE);
+    const int right = rect.left + rect.width - 1;
+    const int bottom = rect.top + rect.height - 1;
+
+    for (int x = rect.left - extrude; x <= right + extrude; ++x) {
+        unsigned sourceX = static_cast<unsigned>(std::clamp(x, rect.left, right));
+        for (int i = 1; i <= extrude; ++i) {
+            page.setPixel(static_cast<unsigned>(x), static_cast<unsigned>(rect.top - i),
+                page.getPixel(sourceX, static_cast<unsigned>(rect.top)));
+            page.setPixel(static_cast<unsigned>(x), static_cast<unsigned>(bottom + i),
+                page.getPixel(sourceX, static_cast<unsigned>(bottom)));
+        }
+    }
+    for (int y = rect.top; y <= bottom; ++y) {
+        for (int i = 1; i <= extrude; ++i) {
+            page.setPixel(static_cast<unsigned>(rect.left - i), static_cast<unsigned>(y),
+                page.getPixel(static_cast<unsigned>(rect.left), static_cast<unsigned>(y)));
+            page.setPixel(static_cast<unsigned>(right + i), static_cast<unsigned>(y),
+                page.getPixel(static_cast<unsigned>(right), static_cast<unsigned>(y)));
+        }
+    }
+}
+//-------------------------------------------------------------------------------------
+void TextureAtlas::adoptSources(TextureManager& textures, const std::vector<PackedEntry>& entries,
+    const std::vector<sf::Image>& pageImages) {
+    // The cached pages already hold every source's pixels, so the source
+    // textures are cut out of them instead of decoding each file again
+    for (const auto& entry : entries) {
+        if (textures.isLoaded(entry.filename)) {
+            continue;
+        }
+        auto texture = std::make_unique<sf::Texture>();
+        if (!texture->loadFromImage(pageImages[entry.page], entry.rect)) {
+            std::cerr << "[TextureAtlas] Could not restore " << entry.filename << " from the cache" << std::endl;
+            continue;
+        }
+        textures.adopt(entry.filename, std::move(texture));
+    }
+}
+//-------------------------------------------------------------------------------------
+bool TextureAtlas::uploadPages(const std::vector<sf::Image>& pageImages) {
+    for (std::size_t i = 0; i < pageImages.size(); ++i) {
+        auto texture = std::make_unique<sf::Texture>();
+        if (!texture->loadFromImage(pageImages[i])) {
+            std::cerr << "[TextureAtlas] Failed to upload atlas page " << i << std::endl;
+            return false;
+        }
+        m_pages.push_back(std::move(texture));
+    }
+    return true;
+}
+//-------------------------------------------------------------------------------------
+std::string TextureAtlas::fileStamp(const std::string& filename) {
+    std::error_code ec;
+    auto size = std::filesystem::file_size(filename, ec);
+    if (ec) {
+        return "missing";
+    }
+    auto time = std::filesystem::last_write_time(filename, ec);
+    if (ec) {
+        return "missing";
+    }
+    return std::to_string(size) + ":" + std::to_string(time.time_since_epoch().count());
+}
+//-------------------------------------------------------------------------------------
+bool TextureAtlas::loadCache(const std::string& cachePath, const std::vector<std::string>& filenames,
+    std::vector<PackedEntry>& entries, std::vector<sf::Image>& pageImages) {
+    std::ifstream file(cachePath);
+    if (!file.is_open()) {
+        return false;
+    }
+
+    std::string tag;
+    int version = 0;
+    if (!(file >> tag >> version) || tag != "TEXTURE_ATLAS" || version != CACHE_VERSION) {
+        return false;
+    }
+
+    // Every requested source must be listed with an unchanged size and timestamp
+    std::size_t sourceCount = 0;
+    if (!(file >> tag >> sourceCount) || tag != "sources" || sourceCount != filenames.size()) {
+        return false;
+    }
+    for (const auto& expected : filenames) {
+        std::string name, stamp;
+        if (!(file >> name >> stamp) || name != expected || stamp != fileStamp(name)) {
+            return false;
+        }
+    }
+
+    std::size_t pageCount = 0;
+    if (!(file >> tag >> pageCount) || tag != "pages" || pageCount == 0) {
+        return false;
+    }
+    pageImages.assign(pageCount, sf::Image());
+    for (auto& image : pageImages) {
+        std::string pageFile;
+        if (!(file >> pageFile) || !image.loadFromFile(pageFile)) {
+            return false;
+        }
+    }
+
+    std::size_t entryCount = 0;
+    if (!(file >> tag >> entryCount) || tag != "entries") {
+        return false;
+    }
+    for (std::size_t i = 0; i < entryCount; ++i) {
+        PackedEntry entry;
+        if (!(file >> entry.filename >> entry.page >> entry.rect.left >> entry.rect.top
+                   >> entry.rect.width >> entry.rect.height) || entry.page >= pageCount) {
+            entries.clear();
+            return false;
+        }
+        entries.push_back(entry);
+    }
+
+    if (!uploadPages(pageImages)) {
+        entries.clear();
+        m_pages.clear();
+        return false;
+    }
+    return true;
+}
+//-------------------------------------------------------------------------------------
+void TextureAtlas::saveCache(const std::string& cachePath, const std::vector<std::string>& filenames,
+    const std::vector<PackedEntry>& entries, const std::vector<sf::Image>& pageImages) const {
+    std::vector<std::string> pageFiles;
+    for (std::size_t i = 0; i < pageImages.size(); ++i) {
+        std::string pageFile = cachePath + ".page" + std::to_string(i) + ".png";
+        if (!pageImages[i].saveToFile(pageFile)) {
+            std::cerr << "[TextureAtlas] Could not write " << pageFile << ", cache skipped" << std::endl;
+            return;
+        }
+        pageFiles.push_back(pageFile);
+    }
+
+    std::ofstream file(cachePath, std::ios::trunc);
+    if (!file.is_open()) {
+        std::cerr << "[TextureAtlas] Could not write " << cachePath << ", cache skipped" << std::endl;
+        return;
+    }
+
+    file << "TEXTURE_ATLAS " << CACHE_VERSION << "\n";
+    file << "sources " << filenames.size() << "\n";
+    for (const auto& name : filenames) {
+        file << name << " " << fileStamp(name) << "\n";
+    }
+    file << "pages " << pageFiles.size() << "\n";
+    for (const auto& pageFile : pageFiles) {
+        file << pageFile << "\n";
+    }
+    file << "entries " << entries.size() << "\n";
+    for (const auto& entry : entries) {
+        file << entry.filename << " " << entry.page << " " << entry.rect.left << " " << entry.rect.top
+             << " " << entry.rect.width << " " << entry.rect.height << "\n";
+    }
+}
+//-------------------------------------------------------------------------------------
+const TextureAtlas::Region* TextureAtlas::find(const sf::Texture& texture) const {
+    auto it = m_regions.find(&texture);
+    return it != m_regions.end() ? &it->second : nullptr;
+}
+//-------------------------------------------------------------------------------------
+void TextureAtlas::clear() {
+    m_regions.clear();
+    m_pages.clear();
+}
+//-------------------------------------------------------------------------------------
@@ -0,0 +1,196 @@
+// Event tape decoder - summarises a tape written by EventTapeRecorder
+// (run the game with EVENT_TAPE=<file> to record one).
+//
+// Usage: event_tape_decoder <tape> [--top N] [--dump]
+//
+// Prints events per type and per second, and the frames with the most
+// events, so the event types that dominate hot frames stand out.
+
+#include "EventTape.h"
+#include "MappedFile.h"
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace {
+    struct TypeStats {
+        std::string name;
+        std::uint64_t count = 0;
+        std::uint64_t bytes = 0;
+        std::uint64_t peakPerSecond = 0;
+    };
+
+    struct FrameStats {
+        std::uint32_t frame = 0;
+        std::uint64_t count = 0;
+        std::map<std::uint8_t, std::uint64_t> perType;
+    };
+
+    std::string nameOf(const std::vector<TypeStats>& types, std::uint8_t id) {
+        return id < types.size() && !types[id].name.empty() ? types[id].name : "type" + std::to_string(id);
+    }
+}
+
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        std::cerr << "Usage: event_tape_decoder <tape> [--top N] [--dump]" << std::endl;
+        return 1;
+    }
+    std::size_t topFrames = 10;
+    bool dump = false;
+    for (int i = 2; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--dump") == 0) {
+            dump = true;
+        }
+        else if (std::strcmp(argv[i], "--top") == 0 && i + 1 < argc) {
+            topFrames = static_cast<std::size_t>(std::atoi(argv[++i]));
+        }
+    }
+
+    MappedFile file;
+    if (!file.openRead(argv[1])) {
+        std::cerr << "Could not open " << argv[1] << std::endl;
+        return 1;
+    }
+    const std::uint8_t* data = file.data();
+    const std::size_t size = file.size();
+
+    // Header and type table
+    if (size < 8 || std::memcmp(data, EventTape::MAGIC, 4) != 0) {
+        std::cerr << argv[1] << " is not an event tape" << std::endl;
+        return 1;
+    }
+    const auto version = EventTape::read<std::uint16_t>(data + 4);
+    const auto typeCount = EventTape::read<std::uint16_t>(data + 6);
+    if (version != EventTape::VERSION) {
+        std::cerr << "Unsupported tape version " << version << std::endl;
+        return 1;
+    }
+
+    std::vector<TypeStats> types(256);
+    std::size_t offset = 8;
+    for (std::uint16_t i = 0; i < typeCount && offset + 2 <= size; ++i) {
+        std::uint8_t id = data[offset];
+        std::uint8_t length = data[offset + 1];
+        offset += 2;
+        if (offset + length > size) {
+            break;
+        }
+        types[id].name.assign(reinterpret_cast<const char*>(data + offset), length);
+        offset += length;
+    }
+
+    // Records
+    std::uint64_t total = 0;
+    std::uint64_t lastMicros = 0;
+    std::uint32_t lastFrame = 0;
+    std::vector<std::vector<std::uint64_t>> perSecond;    // [second][type]
+    std::map<std::uint32_t, FrameStats> frames;
+
+    while (offset + EventTape::RECORD_HEADER_SIZE <= size) {
+        EventTape::RecordHeader header = EventTape::readRecordHeader(data + offset);
+        if (header.type == EventTape::Type::End) {
+            break;
+        }
+        const std::size_t recordSize = EventTape::RECORD_HEADER_SIZE + header.payloadSize;
+        if (offset + recordSize > size) {
+            std::cerr << "Truncated record at byte " << offset << std::endl;
+            break;
+        }
+
+        const auto id = static_cast<std::uint8_t>(header.type);
+        types[id].count++;
+        types[id].bytes += recordSize;
+
+        std::size_t second = static_cast<std::size_t>(header.micros / 1000000);
+        if (second >= perSecond.size()) {
+            perSecond.resize(second + 1, std::vector<std::uint64_t>(256, 0));
+        }
+        perSecond[second][id]++;
+
+        FrameStats& frame = frames[header.frame];
+        frame.frame = header.frame;
+        frame.count++;
+        frame.perType[id]++;
+
+        if (dump) {
+            std::cout << std::setw(8) << header.frame << "  " << std::fixed << std::setprecision(6)
+                << static_cast<double>(header.micros) / 1e6 << "s  " << nameOf(types, id) << " (" << header.payloadSize << " bytes)\n";
+        }
+
+        ++total;
+        lastMicros = std::max(lastMicros, header.micros);
+        lastFrame = std::max(lastFrame, header.frame);
+        offset += recordSize;
+    }
+
+    const double seconds = std::max(static_cast<double>(lastMicros) / 1e6, 1e-6);
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "\n" << total << " events over " << seconds << " s, " << lastFrame << " frames ("
+        << static_cast<double>(total) / seconds << " events/s, " << (lastFrame > 0 ? static_cast<double>(total) / lastFrame : 0.0) << " per frame)\n";
+
+    // Per type
+    for (const auto& second : perSecond) {
+        for (std::size_t id = 0; id < types.size(); ++id) {
+            types[id].peakPerSecond = std::max(types[id].peakPerSecond, second[id]);
+        }
+    }
+    std::vector<std::size_t> order;
+    for (std::size_t id = 0; id < types.size(); ++id) {
+        if (types[id].count > 0) {
+            order.push_back(id);
+        }
+    }
+    std::sort(order.begin(), order.end(), [&](std::size_t a, std::size_t b) { return types[a].count > types[b].count; });
+
+    std::cout << "\n" << std::left << std::setw(22) << "Type" << std::right << std::setw(10) << "Count"
+        << std::setw(9) << "Share" << std::setw(11) << "Avg/s" << std::setw(9) << "Peak/s" << std::setw(12) << "Bytes" << "\n";
+    for (std::size_t id : order) {
+        const TypeStats& type = types[id];
+        std::cout << std::left << std::setw(22) << nameOf(types, static_cast<std::uint8_t>(id)) << std::right
+            << std::setw(10) << type.count
+            << std::setw(8) << 100.0 * static_cast<double>(type.count) / static_cast<double>(std::max<std::uint64_t>(total, 1)) << "%"
+            << std::setw(11) << static_cast<double>(type.count) / seconds
+            << std::setw(9) << type.peakPerSecond
+            << std::setw(12) << type.bytes << "\n";
+    }
+
+    // Per second
+    std::cout << "\nSecond  Events  Busiest type\n";
+    for (std::size_t s = 0; s < perSecond.size(); ++s) {
+        const auto& counts = perSecond[s];
+        auto busiest = std::max_element(counts.begin(), counts.end());
+        std::uint64_t sum = 0;
+        for (std::uint64_t c : counts) {
+            sum += c;
+        }
+        std::cout << std::setw(6) << s << std::setw(8) << sum;
+        if (sum > 0) {
+            std::cout << "  " << nameOf(types, static_cast<std::uint8_t>(busiest - counts.begin())) << " (" << *busiest << ")";
+        }
+        std::cout << "\n";
+    }
+
+    // Hot frames
+    std::vector<const FrameStats*> hottest;
+    for (const auto& [number, frame] : frames) {
+        hottest.push_back(&frame);
+    }
+    std::sort(hottest.begin(), hottest.end(), [](const FrameStats* a, const FrameStats* b) { return a->count > b->count; });
+    hottest.resize(std::min(hottest.size(), topFrames));
+
+    std::cout << "\nHottest frames\n";
+    for (const FrameStats* frame : hottest) {
+        std::cout << "  frame " << std::setw(7) << frame->frame << std::setw(6) << frame->count << " events:";
+        for (const auto& [id, count] : frame->perType) {
+            std::cout << " " << nameOf(types, id) << "=" << count;
+        }
+        std::cout << "\n";
+    }
+    return 0;
+}
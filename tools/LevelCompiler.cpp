@@ -0,0 +1,117 @@
+// Level compiler - turns text levels into the binary .lvlb format read by
+// LevelLoader (see CompiledLevel.h).
+//
+// Usage: level_compiler [-o output_dir] <level.txt>...
+//
+// Each level is written as <name>.lvlb, next to its source unless an output
+// directory is given, then read back and checked against the source.
+
+#include "CompiledLevel.h"
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace {
+    namespace fs = std::filesystem;
+
+    bool readLines(const fs::path& path, std::vector<std::string>& lines) {
+        std::ifstream file(path);
+        if (!file.is_open()) {
+            return false;
+        }
+        std::string line;
+        while (std::getline(file, line)) {
+            if (!line.empty() && line.back() == '\r') {
+                line.pop_back();    // CRLF files
+            }
+            lines.push_back(line);
+        }
+        return true;
+    }
+
+    bool matchesSource(const CompiledLevel& level, const std::vector<std::string>& lines) {
+        std::vector<std::string> rows = level.decodeGrid();
+        if (rows.size() != lines.size()) {
+            return false;
+        }
+        for (std::size_t row = 0; row < rows.size(); ++row) {
+            for (std::size_t column = 0; column < rows[row].size(); ++column) {
+                char source = column < lines[row].size() ? lines[row][column] : CompiledLevel::EMPTY_TILE;
+                if (rows[row][column] != source) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    bool compileLevel(const fs::path& input, const fs::path& outputDir) {
+        std::vector<std::string> lines;
+        if (!readLines(input, lines)) {
+            std::cerr << "Could not read " << input.string() << std::endl;
+            return false;
+        }
+
+        std::vector<std::uint8_t> image = CompiledLevel::compile(lines);
+        if (image.empty()) {
+            std::cerr << input.string() << " has too many rows" << std::endl;
+            return false;
+        }
+
+        fs::path output = (outputDir.empty() ? input.parent_path() : outputDir) / input.filename();
+        output.replace_extension(".lvlb");
+        {
+            std::ofstream file(output, std::ios::binary | std::ios::trunc);
+            file.write(reinterpret_cast<const char*>(image.data()), static_cast<std::streamsize>(image.size()));
+            if (!file) {
+                std::cerr << "Could not write " << output.string() << std::endl;
+                return false;
+            }
+        }
+
+        CompiledLevel level;
+        if (!level.open(output.string()) || !matchesSource(level, lines)) {
+            std::cerr << output.string() << " does not match " << input.string() << std::endl;
+            return false;
+        }
+
+        std::error_code error;
+        std::cout << input.string() << " -> " << output.string() << ": " << level.getWidth() << "x"
+            << level.getHeight() << " tiles, " << level.getSpawnCount() << " spawns, "
+            << fs::file_size(input, error) << " -> " << image.size() << " bytes" << std::endl;
+        return true;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    fs::path outputDir;
+    std::vector<fs::path> inputs;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "-o") == 0 && i + 1 < argc) {
+            outputDir = argv[++i];
+        }
+        else {
+            inputs.emplace_back(argv[i]);
+        }
+    }
+    if (inputs.empty()) {
+        std::cerr << "Usage: level_compiler [-o output_dir] <level.txt>..." << std::endl;
+        return 1;
+    }
+
+    if (!outputDir.empty()) {
+        std::error_code error;
+        fs::create_directories(outputDir, error);
+    }
+
+    int failures = 0;
+    for (const auto& input : inputs) {
+        if (!compileLevel(input, outputDir)) {
+            ++failures;
+        }
+    }
+    return failures == 0 ? 0 : 1;
+}
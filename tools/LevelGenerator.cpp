@@ -0,0 +1,259 @@
+// Level generator - writes large, reproducible levels in the text tile format
+// for load-time, memory and frame-time benchmarks.
+//
+// Usage: level_generator [options] <output.txt>
+//   --columns N    level length in tiles (default 1000)
+//   --seed N       random seed (default 1); the same seed gives the same level
+//   --coins F      chance of a coin per column and row (default 0.15)
+//   --enemies F    chance of an enemy per column (default 0.04)
+//   --mix z:Z:F    relative weights of square, smart and falcon enemies (default 3:2:1)
+//   --gifts F      chance of a gift per column (default 0.02)
+//   --obstacles F  chance of a cactus or box per column (default 0.03)
+//   --wells F      chance of a well per column (default 0.002)
+//   --sea F        chance of a sea gap starting per column (default 0.02)
+//   --max-gap N    widest sea gap in tiles (default 3)
+//   --compile      also write <output>.lvlb next to the text file
+//
+// Levels have three rows like the shipped ones: ground (row 0 of the file),
+// then two rows of items and enemies above it. Nothing is placed over the
+// sea or in the first columns where the player spawns, and the flag ends
+// the level.
+
+#include "CompiledLevel.h"
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace {
+    namespace fs = std::filesystem;
+
+    constexpr std::size_t SAFE_COLUMNS = 4;     // Kept clear around the player spawn
+    constexpr std::size_t MIN_COLUMNS = SAFE_COLUMNS + 4;
+
+    struct Options {
+        std::size_t columns = 1000;
+        std::uint64_t seed = 1;
+        double coins = 0.15;
+        double enemies = 0.04;
+        unsigned mix[3] = { 3, 2, 1 };
+        double gifts = 0.02;
+        double obstacles = 0.03;
+        double wells = 0.002;
+        double sea = 0.02;
+        std::size_t maxGap = 3;
+        bool compile = false;
+        fs::path output;
+    };
+
+    // splitmix64: fully specified, unlike the standard distributions, whose
+    // output differs between library implementations for the same seed
+    class Random {
+    public:
+        explicit Random(std::uint64_t seed) : m_state(seed) {}
+
+        std::uint64_t next() {
+            std::uint64_t z = (m_state += 0x9E3779B97F4A7C15ull);
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+            return z ^ (z >> 31);
+        }
+
+        double unit() { return static_cast<double>(next() >> 11) * (1.0 / 9007199254740992.0); }
+        bool chance(double p) { return unit() < p; }
+        std::size_t below(std::size_t n) { return static_cast<std::size_t>(next() % n); }
+
+    private:
+        std::uint64_t m_state;
+    };
+
+    const char GIFTS[] = { 'h', 's', 'p', '*', 'r', 'w', 'm' };
+    const char ENEMIES[] = { 'z', 'Z', 'F' };
+
+    char pickEnemy(Random& random, const unsigned (&mix)[3]) {
+        const unsigned total = mix[0] + mix[1] + mix[2];
+        std::size_t roll = random.below(total);
+        for (int i = 0; i < 3; ++i) {
+            if (roll < mix[i]) {
+                return ENEMIES[i];
+            }
+            roll -= mix[i];
+        }
+        return ENEMIES[0];
+    }
+
+    std::vector<std::string> generate(const Options& options) {
+        const std::size_t columns = options.columns;
+        std::vector<std::string> rows(3, std::string(columns, CompiledLevel::EMPTY_TILE));
+        std::string& ground = rows[0];
+        std::string& lower = rows[1];
+        std::string& upper = rows[2];
+        Random random(options.seed);
+
+        // Ground first, so items know where the sea is
+        ground.assign(columns, 'M');
+        ground.front() = 'L';
+        ground.back() = 'R';
+        for (std::size_t column = SAFE_COLUMNS; column + SAFE_COLUMNS < columns; ++column) {
+            if (random.chance(options.sea)) {
+                const std::size_t width = 1 + random.below(options.maxGap);
+                if (column + width + SAFE_COLUMNS + 1 >= columns) {
+                    break;
+                }
+                ground[column] = 'E';
+                for (std::size_t i = 1; i <= width; ++i) {
+                    ground[column + i] = 'S';
+                }
+                ground[column + width + 1] = 'E';
+                column += width + 1;
+            }
+            else if (random.chance(options.wells)) {
+                ground[column] = 'W';
+            }
+        }
+
+        for (std::size_t column = SAFE_COLUMNS; column + 1 < columns; ++column) {
+            if (ground[column] == 'S' || ground[column] == 'W') {
+                continue;
+            }
+            if (random.chance(options.enemies)) {
+                lower[column] = pickEnemy(random, options.mix);
+            }
+            else if (random.chance(options.obstacles)) {
+                lower[column] = random.chance(0.5) ? 'c' : 'B';
+            }
+            else if (random.chance(options.gifts)) {
+                lower[column] = GIFTS[random.below(sizeof(GIFTS))];
+            }
+            else if (random.chance(options.coins)) {
+                lower[column] = 'C';
+            }
+
+            if (random.chance(options.gifts)) {
+                upper[column] = GIFTS[random.below(sizeof(GIFTS))];
+            }
+            else if (random.chance(options.coins)) {
+                upper[column] = 'C';
+            }
+        }
+
+        lower[columns - 2] = 'X';
+        return rows;
+    }
+
+    bool writeText(const fs::path& path, const std::vector<std::string>& rows) {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        for (std::size_t row = 0; row < rows.size(); ++row) {
+            file << rows[row];
+            if (row + 1 < rows.size()) {
+                file << '\n';
+            }
+        }
+        return static_cast<bool>(file);
+    }
+
+    bool writeCompiled(const fs::path& path, const std::vector<std::string>& rows) {
+        std::vector<std::uint8_t> image = CompiledLevel::compile(rows);
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file.write(reinterpret_cast<const char*>(image.data()), static_cast<std::streamsize>(image.size()));
+        return !image.empty() && static_cast<bool>(file);
+    }
+
+    bool parseMix(const char* text, unsigned (&mix)[3]) {
+        char* end = nullptr;
+        for (int i = 0; i < 3; ++i) {
+            mix[i] = static_cast<unsigned>(std::strtoul(text, &end, 10));
+            if (end == text || (i < 2 && *end != ':')) {
+                return false;
+            }
+            text = end + 1;
+        }
+        return *end == '\0' && mix[0] + mix[1] + mix[2] > 0;
+    }
+
+    bool parseArguments(int argc, char* argv[], Options& options) {
+        for (int i = 1; i < argc; ++i) {
+            const char* arg = argv[i];
+            const char* value = i + 1 < argc ? argv[i + 1] : nullptr;
+            auto takes = [&](const char* name) {
+                if (std::strcmp(arg, name) != 0 || !value) {
+                    return false;
+                }
+                ++i;
+                return true;
+            };
+
+            if (takes("--columns")) options.columns = std::strtoull(value, nullptr, 10);
+            else if (takes("--seed")) options.seed = std::strtoull(value, nullptr, 10);
+            else if (takes("--coins")) options.coins = std::atof(value);
+            else if (takes("--enemies")) options.enemies = std::atof(value);
+            else if (takes("--gifts")) options.gifts = std::atof(value);
+            else if (takes("--obstacles")) options.obstacles = std::atof(value);
+            else if (takes("--wells")) options.wells = std::atof(value);
+            else if (takes("--sea")) options.sea = std::atof(value);
+            else if (takes("--max-gap")) options.maxGap = std::strtoull(value, nullptr, 10);
+            else if (takes("--mix")) {
+                if (!parseMix(value, options.mix)) {
+                    std::cerr << "Bad --mix " << value << " (expected z:Z:F weights)" << std::endl;
+                    return false;
+                }
+            }
+            else if (std::strcmp(arg, "--compile") == 0) options.compile = true;
+            else if (arg[0] == '-' && arg[1] != '\0') {
+                std::cerr << "Unknown option " << arg << std::endl;
+                return false;
+            }
+            else options.output = arg;
+        }
+
+        if (options.output.empty()) {
+            return false;
+        }
+        if (options.columns < MIN_COLUMNS || options.maxGap == 0) {
+            std::cerr << "Levels need at least " << MIN_COLUMNS << " columns and gaps at least 1 tile" << std::endl;
+            return false;
+        }
+        return true;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    Options options;
+    if (!parseArguments(argc, argv, options)) {
+        std::cerr << "Usage: level_generator [--columns N] [--seed N] [--coins F] [--enemies F] [--mix z:Z:F]\n"
+            << "                       [--gifts F] [--obstacles F] [--wells F] [--sea F] [--max-gap N]\n"
+            << "                       [--compile] <output.txt>" << std::endl;
+        return 1;
+    }
+
+    const std::vector<std::string> rows = generate(options);
+
+    if (!writeText(options.output, rows)) {
+        std::cerr << "Could not write " << options.output.string() << std::endl;
+        return 1;
+    }
+
+    std::size_t spawns = 0;
+    for (const auto& row : rows) {
+        for (char c : row) {
+            spawns += CompiledLevel::isSpawnChar(c) ? 1u : 0u;
+        }
+    }
+    std::cout << options.output.string() << ": " << options.columns << "x" << rows.size()
+        << " tiles, " << spawns << " spawns, seed " << options.seed << std::endl;
+
+    if (options.compile) {
+        fs::path compiled = options.output;
+        compiled.replace_extension(".lvlb");
+        if (!writeCompiled(compiled, rows)) {
+            std::cerr << "Could not write " << compiled.string() << std::endl;
+            return 1;
+        }
+        std::cout << "  -> " << compiled.string() << std::endl;
+    }
+    return 0;
+}
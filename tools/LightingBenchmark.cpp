@@ -0,0 +1,174 @@
+// Lighting benchmark - compares brute-force shadow casting against the
+// ObstacleGrid used by DarkLevelSystem.
+//
+// Usage: lighting_benchmark [obstacles] [lights] [frames]
+
+#include "ObstacleGrid.h"
+#include "VisibilityPolygon.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace {
+    constexpr float TILE = 192.0f;
+    constexpr float LIGHT_RADIUS = 400.0f;
+    constexpr float FLASHLIGHT_RANGE = 800.0f;
+    constexpr int FLASHLIGHT_RAYS = 31;
+
+    using Clock = std::chrono::steady_clock;
+
+    struct Scene {
+        std::vector<sf::FloatRect> obstacles;
+        std::vector<sf::Vector2f> lights;
+    };
+
+    double elapsedMs(Clock::time_point start) {
+        return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    }
+
+    Scene makeScene(int obstacleCount, int lightCount) {
+        Scene scene;
+        std::mt19937 rng(1234);
+
+        // Roughly the shape of a long side-scrolling level
+        float width = std::max(40.0f, obstacleCount / 8.0f) * TILE;
+        float height = 12.0f * TILE;
+        std::uniform_real_distribution<float> x(0.0f, width);
+        std::uniform_real_distribution<float> y(0.0f, height);
+        std::uniform_real_distribution<float> size(TILE * 0.25f, TILE);
+
+        for (int i = 0; i < obstacleCount; ++i) {
+            scene.obstacles.emplace_back(x(rng), y(rng), size(rng), size(rng));
+        }
+        for (int i = 0; i < lightCount; ++i) {
+            scene.lights.emplace_back(x(rng), y(rng));
+        }
+        return scene;
+    }
+
+    // Same slab test the grid runs, over every obstacle
+    float bruteRaycast(const std::vector<sf::FloatRect>& obstacles, const sf::Vector2f& origin,
+        const sf::Vector2f& direction, float maxDistance) {
+        float best = maxDistance;
+        for (const auto& box : obstacles) {
+            float right = box.left + box.width;
+            float bottom = box.top + box.height;
+            if (origin.x > box.left && origin.x < right && origin.y > box.top && origin.y < bottom) {
+                continue;
+            }
+            float ix = direction.x != 0.0f ? 1.0f / direction.x : std::numeric_limits<float>::infinity();
+            float iy = direction.y != 0.0f ? 1.0f / direction.y : std::numeric_limits<float>::infinity();
+            float tx1 = (box.left - origin.x) * ix, tx2 = (right - origin.x) * ix;
+            float ty1 = (box.top - origin.y) * iy, ty2 = (bottom - origin.y) * iy;
+            float tNear = std::max(std::min(tx1, tx2), std::min(ty1, ty2));
+            float tFar = std::min(std::max(tx1, tx2), std::max(ty1, ty2));
+            if (tFar >= 0.0f && tNear <= tFar && tNear < best) {
+                best = std::max(tNear, 0.0f);
+            }
+        }
+        return best;
+    }
+
+    sf::Vector2f rayDirection(int light, int ray) {
+        float angle = light * 0.7f + ray * (3.14159265f / 4.0f) / FLASHLIGHT_RAYS;
+        return { std::cos(angle), std::sin(angle) };
+    }
+}
+
+int main(int argc, char* argv[]) {
+    int obstacleCount = argc > 1 ? std::atoi(argv[1]) : 5000;
+    int lightCount = argc > 2 ? std::atoi(argv[2]) : 50;
+    int frames = argc > 3 ? std::atoi(argv[3]) : 20;
+
+    Scene scene = makeScene(obstacleCount, lightCount);
+    ObstacleGrid grid(TILE * 2.0f);
+    for (const auto& rect : scene.obstacles) {
+        grid.add(rect);
+    }
+
+    VisibilityPolygon polygon;
+    std::vector<ObstacleGrid::Id> nearby;
+    std::size_t bruteVertices = 0;
+    std::size_t gridVertices = 0;
+    int rayMismatches = 0;
+
+    // Light polygons
+    auto start = Clock::now();
+    for (int frame = 0; frame < frames; ++frame) {
+        for (const auto& light : scene.lights) {
+            polygon.begin(light, LIGHT_RADIUS);
+            for (const auto& rect : scene.obstacles) {
+                polygon.addObstacle(rect);
+            }
+            bruteVertices += polygon.build().size();
+        }
+    }
+    double bruteLightMs = elapsedMs(start) / frames;
+
+    start = Clock::now();
+    for (int frame = 0; frame < frames; ++frame) {
+        for (const auto& light : scene.lights) {
+            nearby.clear();
+            grid.queryRadius(light, LIGHT_RADIUS, nearby);
+            polygon.begin(light, LIGHT_RADIUS);
+            for (ObstacleGrid::Id id : nearby) {
+                polygon.addObstacle(grid.getBounds(id));
+            }
+            gridVertices += polygon.build().size();
+        }
+    }
+    double gridLightMs = elapsedMs(start) / frames;
+
+    // Flashlight rays
+    float checksum = 0.0f;
+    start = Clock::now();
+    for (int frame = 0; frame < frames; ++frame) {
+        for (int l = 0; l < lightCount; ++l) {
+            for (int r = 0; r < FLASHLIGHT_RAYS; ++r) {
+                checksum += bruteRaycast(scene.obstacles, scene.lights[l], rayDirection(l, r), FLASHLIGHT_RANGE);
+            }
+        }
+    }
+    double bruteRayMs = elapsedMs(start) / frames;
+
+    start = Clock::now();
+    for (int frame = 0; frame < frames; ++frame) {
+        for (int l = 0; l < lightCount; ++l) {
+            for (int r = 0; r < FLASHLIGHT_RAYS; ++r) {
+                ObstacleGrid::RayHit hit;
+                float distance = grid.raycast(scene.lights[l], rayDirection(l, r), FLASHLIGHT_RANGE, hit)
+                    ? hit.distance : FLASHLIGHT_RANGE;
+                checksum -= distance;
+            }
+        }
+    }
+    double gridRayMs = elapsedMs(start) / frames;
+
+    for (int l = 0; l < lightCount; ++l) {
+        for (int r = 0; r < FLASHLIGHT_RAYS; ++r) {
+            ObstacleGrid::RayHit hit;
+            float distance = grid.raycast(scene.lights[l], rayDirection(l, r), FLASHLIGHT_RANGE, hit)
+                ? hit.distance : FLASHLIGHT_RANGE;
+            float expected = bruteRaycast(scene.obstacles, scene.lights[l], rayDirection(l, r), FLASHLIGHT_RANGE);
+            if (std::abs(expected - distance) > 0.01f) {
+                ++rayMismatches;
+            }
+        }
+    }
+
+    std::cout << "[LightingBenchmark] " << obstacleCount << " obstacles, " << lightCount
+        << " lights, " << frames << " frames\n";
+    std::cout << "  light polygons  brute: " << bruteLightMs << " ms/frame  grid: " << gridLightMs
+        << " ms/frame  speedup: x" << bruteLightMs / std::max(gridLightMs, 1e-6) << "\n";
+    std::cout << "  flashlight rays brute: " << bruteRayMs << " ms/frame  grid: " << gridRayMs
+        << " ms/frame  speedup: x" << bruteRayMs / std::max(gridRayMs, 1e-6) << "\n";
+    std::cout << "  polygon vertices brute/grid: " << bruteVertices << "/" << gridVertices
+        << "  ray mismatches: " << rayMismatches << "  (checksum " << checksum << ")\n";
+
+    return (bruteVertices == gridVertices && rayMismatches == 0) ? 0 : 1;
+}